@@ -0,0 +1,483 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <QtCore>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "dictionarygenerator.h"
+#include "dictionaryparser.h"
+#include "dictionaryindex.h"
+#include "anagramsearch.h"
+#include "sortedkey.h"
+
+/*
+ *  Micro-benchmarks of the search kernel, key building and the dictionary parser.
+ *  Every benchmark is warmed up first, then repeated a number of times, and the
+ *  statistics of the repetitions are reported as a table or as JSON:
+ *
+ *  anagrams_bench --dictionary words.txt --seeds owl,ail --repetitions 20 --json
+ *
+ *  The scaling mode generates synthetic dictionaries of the specified sizes and reports
+ *  how the load time, the memory and the search time grow:
+ *
+ *  anagrams_bench --sweep 10000,100000,1000000
+ */
+
+namespace
+{
+
+struct Statistics
+{
+    QString name;
+    QString unit;
+    int repetitions;
+    // items processed by a single repetition (keys, lookups, bytes...)
+    qint64 items;
+    // nanoseconds
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    double p95;
+};
+
+// the results of the benchmarks are accumulated here, so the compiler cannot throw them away
+volatile quint64 sink = 0;
+
+Statistics measure(const QString &name,
+                   const QString &unit,
+                   qint64 items,
+                   int warmup,
+                   int repetitions,
+                   const std::function<void()> &body)
+{
+    for(int i = 0;i < warmup;i++)
+        body();
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+
+    QElapsedTimer timer;
+
+    for(int i = 0;i < repetitions;i++)
+    {
+        timer.start();
+        body();
+        samples.push_back(static_cast<double>(timer.nsecsElapsed()));
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    Statistics statistics;
+
+    statistics.name = name;
+    statistics.unit = unit;
+    statistics.repetitions = repetitions;
+    statistics.items = items;
+    statistics.min = samples.front();
+    statistics.median = samples[samples.size() / 2];
+    statistics.p95 = samples[std::min(samples.size() - 1, static_cast<std::size_t>(std::ceil(samples.size() * 0.95)) - 1)];
+
+    double sum = 0;
+
+    for(double sample : samples)
+        sum += sample;
+
+    statistics.mean = sum / samples.size();
+
+    double variance = 0;
+
+    for(double sample : samples)
+        variance += (sample - statistics.mean) * (sample - statistics.mean);
+
+    statistics.stddev = samples.size() > 1 ? std::sqrt(variance / (samples.size() - 1)) : 0;
+
+    return statistics;
+}
+
+double throughput(const Statistics &statistics)
+{
+    return statistics.median > 0 ? statistics.items / (statistics.median / 1e9) : 0;
+}
+
+QJsonObject toJson(const Statistics &statistics)
+{
+    QJsonObject object;
+
+    object["name"] = statistics.name;
+    object["unit"] = statistics.unit;
+    object["repetitions"] = statistics.repetitions;
+    object["items"] = static_cast<double>(statistics.items);
+    object["min_ns"] = statistics.min;
+    object["median_ns"] = statistics.median;
+    object["mean_ns"] = statistics.mean;
+    object["stddev_ns"] = statistics.stddev;
+    object["p95_ns"] = statistics.p95;
+    object["throughput_per_s"] = throughput(statistics);
+
+    return object;
+}
+
+void printTable(const QList<Statistics> &results)
+{
+    QTextStream out(stdout);
+
+    out << QString("benchmark").leftJustified(28)
+        << QString("median, ms").rightJustified(14)
+        << QString("mean, ms").rightJustified(14)
+        << QString("stddev, ms").rightJustified(14)
+        << QString("p95, ms").rightJustified(14)
+        << QString("throughput").rightJustified(20)
+        << '\n';
+
+    for(const Statistics &statistics : results)
+    {
+        out << statistics.name.leftJustified(28)
+            << QString::number(statistics.median / 1e6, 'f', 3).rightJustified(14)
+            << QString::number(statistics.mean / 1e6, 'f', 3).rightJustified(14)
+            << QString::number(statistics.stddev / 1e6, 'f', 3).rightJustified(14)
+            << QString::number(statistics.p95 / 1e6, 'f', 3).rightJustified(14)
+            << QString("%1 %2/s").arg(throughput(statistics), 0, 'g', 4).arg(statistics.unit).rightJustified(20)
+            << '\n';
+    }
+}
+
+struct SweepPoint
+{
+    qint64 words;
+    qint64 bytes;
+    Statistics parse;
+    Statistics build;
+    qint64 indexSize;
+    Statistics search;
+};
+
+QJsonObject toJson(const SweepPoint &point)
+{
+    QJsonObject object;
+
+    object["words"] = static_cast<double>(point.words);
+    object["bytes"] = static_cast<double>(point.bytes);
+    object["index_bytes"] = static_cast<double>(point.indexSize);
+    object["parse"] = toJson(point.parse);
+    object["index-build"] = toJson(point.build);
+    object["search"] = toJson(point.search);
+
+    return object;
+}
+
+void printSweepTable(const QList<SweepPoint> &points)
+{
+    QTextStream out(stdout);
+
+    out << QString("words").leftJustified(12)
+        << QString("file, KB").rightJustified(14)
+        << QString("parse, ms").rightJustified(14)
+        << QString("build, ms").rightJustified(14)
+        << QString("index, KB").rightJustified(14)
+        << QString("search, ms").rightJustified(14)
+        << '\n';
+
+    for(const SweepPoint &point : points)
+    {
+        out << QString::number(point.words).leftJustified(12)
+            << QString::number(point.bytes / 1024).rightJustified(14)
+            << QString::number(point.parse.median / 1e6, 'f', 3).rightJustified(14)
+            << QString::number(point.build.median / 1e6, 'f', 3).rightJustified(14)
+            << QString::number(point.indexSize / 1024).rightJustified(14)
+            << QString::number(point.search.median / 1e6, 'f', 3).rightJustified(14)
+            << '\n';
+    }
+}
+
+/*
+ *  Run the parse, build and search benchmarks on generated dictionaries of growing size.
+ *  The search benchmark starts from the roots of the planted chains
+ */
+int runSweep(const QStringList &sizes, quint32 seed, int warmup, int repetitions, bool json)
+{
+    QList<SweepPoint> points;
+
+    for(const QString &size : sizes)
+    {
+        DictionaryGenerator::Parameters parameters;
+        parameters.seed = seed;
+        parameters.words = size.toLongLong();
+
+        if(parameters.words <= 0)
+        {
+            qCritical("Invalid dictionary size: %s", qPrintable(size));
+            return 1;
+        }
+
+        DictionaryGenerator generator(parameters);
+        const QByteArray contents = generator.generate();
+        const QStringList seeds = generator.seeds();
+
+        SweepPoint point;
+        point.words = parameters.words;
+        point.bytes = contents.size();
+
+        Anagrams anagrams;
+
+        point.parse = measure("parse", "B", contents.size(), warmup, repetitions, [&contents, &anagrams]() {
+            DictionaryParser parser;
+            QBuffer buffer;
+            buffer.setData(contents);
+            buffer.open(QIODevice::ReadOnly);
+            parser.parse(&buffer);
+            anagrams = parser.anagrams();
+        });
+
+        DictionaryIndex index;
+
+        point.build = measure("index-build", "key", anagrams.size(), warmup, repetitions, [&anagrams, &index]() {
+            index = DictionaryIndex::build(anagrams, QByteArray());
+        });
+
+        point.indexSize = index.dataSize();
+
+        // one repetition searches from all the seeds
+        point.search = measure("search", "query", seeds.size(), warmup, repetitions, [&index, &seeds]() {
+            AnagramSearch search(index);
+
+            for(const QString &seed : seeds)
+                sink += search.find(seed).size();
+        });
+
+        points.append(point);
+    }
+
+    if(json)
+    {
+        QJsonArray array;
+
+        for(const SweepPoint &point : points)
+            array.append(toJson(point));
+
+        QJsonObject root;
+        root["seed"] = static_cast<double>(seed);
+        root["warmup"] = warmup;
+        root["repetitions"] = repetitions;
+        root["sweep"] = array;
+
+        QTextStream(stdout) << QJsonDocument(root).toJson();
+    }
+    else
+        printSweepTable(points);
+
+    return 0;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Micro-benchmarks of the anagram derivation finder");
+    parser.addHelpOption();
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to benchmark with.", "path");
+    const QCommandLineOption seedsOption("seeds", "Comma-separated starting words for the search benchmark.", "words", "owl,ail,tea");
+    const QCommandLineOption warmupOption("warmup", "Number of warm-up runs.", "count", "3");
+    const QCommandLineOption repetitionsOption("repetitions", "Number of measured runs.", "count", "10");
+    const QCommandLineOption keysOption("keys", "Maximum number of keys for the key building and lookup benchmarks.", "count", "100000");
+    const QCommandLineOption filterOption("filter", "Run only the benchmarks containing the text.", "text");
+    const QCommandLineOption jsonOption("json", "Print the results as JSON.");
+    const QCommandLineOption sweepOption("sweep", "Benchmark generated dictionaries of the comma-separated sizes instead.", "sizes");
+    const QCommandLineOption generatorSeedOption("generator-seed", "Random seed of the generated dictionaries.", "seed", "1");
+
+    parser.addOptions({ dictionaryOption, seedsOption, warmupOption, repetitionsOption, keysOption, filterOption, jsonOption,
+                        sweepOption, generatorSeedOption });
+    parser.process(app);
+
+    const int warmup = std::max(0, parser.value(warmupOption).toInt());
+    const int repetitions = std::max(1, parser.value(repetitionsOption).toInt());
+
+    if(parser.isSet(sweepOption))
+        return runSweep(parser.value(sweepOption).split(',', Qt::SkipEmptyParts),
+                        parser.value(generatorSeedOption).toUInt(),
+                        warmup,
+                        repetitions,
+                        parser.isSet(jsonOption));
+
+    if(!parser.isSet(dictionaryOption))
+    {
+        qCritical("The dictionary is not specified");
+        parser.showHelp(1);
+    }
+
+    const QString filter = parser.value(filterOption);
+
+    QFile file(parser.value(dictionaryOption));
+
+    if(!file.open(QFile::ReadOnly))
+    {
+        qCritical("Cannot open the dictionary: %s", qPrintable(file.errorString()));
+        return 1;
+    }
+
+    const QByteArray contents = file.readAll();
+
+    // the index for the rest of the benchmarks
+    DictionaryParser dictionaryParser;
+    QBuffer buffer;
+    buffer.setData(contents);
+    buffer.open(QIODevice::ReadOnly);
+    dictionaryParser.parse(&buffer);
+
+    const DictionaryIndex index = DictionaryIndex::build(dictionaryParser.anagrams(), dictionaryParser.fingerprint());
+
+    if(index.isNull() || index.size() == 0)
+    {
+        qCritical("The dictionary is empty");
+        return 1;
+    }
+
+    std::vector<std::string> keys;
+    const std::size_t maxKeys = static_cast<std::size_t>(std::max(1, parser.value(keysOption).toInt()));
+
+    index.forEachGroup([&keys, maxKeys](const DictionaryIndex::Group &group) {
+        if(keys.size() < maxKeys)
+            keys.push_back(group.keyString());
+    });
+
+    QList<Statistics> results;
+
+    auto enabled = [&filter](const QString &name) {
+        return filter.isEmpty() || name.contains(filter);
+    };
+
+    if(enabled("parse"))
+    {
+        results.append(measure("parse", "B", contents.size(), warmup, repetitions, [&contents]() {
+            DictionaryParser parser;
+            QBuffer buffer;
+            buffer.setData(contents);
+            buffer.open(QIODevice::ReadOnly);
+            parser.parse(&buffer);
+            sink += parser.anagrams().size();
+        }));
+    }
+
+    if(enabled("index-build"))
+    {
+        const Anagrams anagrams = dictionaryParser.anagrams();
+
+        results.append(measure("index-build", "key", anagrams.size(), warmup, repetitions, [&anagrams]() {
+            sink += DictionaryIndex::build(anagrams, QByteArray()).size();
+        }));
+    }
+
+    if(enabled("key-building"))
+    {
+        results.append(measure("key-building", "key", static_cast<qint64>(keys.size()) * alphabetSize, warmup, repetitions, [&keys]() {
+            char result[256];
+
+            for(const std::string &key : keys)
+            {
+                if(key.length() >= sizeof(result))
+                    continue;
+
+                for(int letter = 0;letter < alphabetSize;letter++)
+                {
+                    insertIntoSortedKey(key.c_str(), static_cast<int>(key.length()), alphabet[letter], result);
+                    sink += static_cast<unsigned char>(result[0]);
+                }
+            }
+        }));
+    }
+
+    if(enabled("lookup"))
+    {
+        // the same probes as the search makes: hits and misses. They are built in advance
+        // one after another, so only the lookups are measured
+        std::string probes;
+        std::vector<int> probeLengths;
+        char probe[256];
+
+        for(const std::string &key : keys)
+        {
+            if(key.length() >= sizeof(probe))
+                continue;
+
+            for(int letter = 0;letter < alphabetSize;letter++)
+            {
+                insertIntoSortedKey(key.c_str(), static_cast<int>(key.length()), alphabet[letter], probe);
+                probes.append(probe, key.length() + 1);
+                probeLengths.push_back(static_cast<int>(key.length()) + 1);
+            }
+        }
+
+        results.append(measure("lookup", "probe", static_cast<qint64>(probeLengths.size()), warmup, repetitions, [&probes, &probeLengths, &index]() {
+            const char *probe = probes.data();
+
+            for(const int length : probeLengths)
+            {
+                sink += index.group(probe, length).size();
+                probe += length;
+            }
+        }));
+    }
+
+    for(const QString &seed : parser.value(seedsOption).split(',', Qt::SkipEmptyParts))
+    {
+        const QString name = "search/" + seed;
+
+        if(!enabled(name))
+            continue;
+
+        results.append(measure(name, "query", 1, warmup, repetitions, [&index, &seed]() {
+            AnagramSearch search(index);
+            sink += search.find(seed).size();
+        }));
+    }
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonArray array;
+
+        for(const Statistics &statistics : results)
+            array.append(toJson(statistics));
+
+        QJsonObject root;
+        root["dictionary"] = parser.value(dictionaryOption);
+        root["warmup"] = warmup;
+        root["benchmarks"] = array;
+
+        QTextStream(stdout) << QJsonDocument(root).toJson();
+    }
+    else
+        printTable(results);
+
+    return 0;
+}
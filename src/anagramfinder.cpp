@@ -25,23 +25,29 @@
 
 #include <QtCore>
 
-#include "anagramfinderthread.h"
 #include "anagramfinder.h"
-#include "anagrams.h"
 #include "ui_anagramfinder.h"
 
-AnagramFinder::AnagramFinder(const Anagrams &anagrams, const QString &word, QWidget *parent)
+AnagramFinder::AnagramFinder(const DictionaryIndex &index,
+                             const QString &word,
+                             const SearchConstraints &constraints,
+                             bool profile,
+                             QWidget *parent)
     : NonRejectableDialog(parent)
     , ui(new Ui::AnagramFinder)
-    , m_thread(new AnagramFinderThread(anagrams, word, this))
+    , m_index(index)
+    , m_word(word)
+    , m_constraints(constraints)
+    , m_profile(profile)
+    , m_stream(new ChainStream)
 {
     ui->setupUi(this);
     setWindowFlags(windowFlags() | Qt::FramelessWindowHint);
 
     ui->progress->startAnimation();
 
-    // when the thread finishes(), we close the dialog
-    connect(m_thread, SIGNAL(finished()), this, SLOT(accept()));
+    // when the query finishes(), we close the dialog
+    connect(&m_watcher, SIGNAL(finished()), this, SLOT(accept()));
 
     // delayed start
     QTimer::singleShot(0, this, SLOT(slotStart()));
@@ -54,15 +60,31 @@ AnagramFinder::~AnagramFinder()
 
 LongestPaths AnagramFinder::longestPaths() const
 {
-    return m_thread->longestPaths();
+    if(!m_watcher.isFinished())
+    {
+        qWarning("The query is still running, returning an empty result");
+        return LongestPaths();
+    }
+
+    return m_watcher.result().longestPaths;
 }
 
 qint64 AnagramFinder::algorithmTime() const
 {
-    return m_thread->algorithmTime();
+    return m_watcher.isFinished() ? m_watcher.result().algorithmTime : 0;
+}
+
+SearchStatistics AnagramFinder::statistics() const
+{
+    return m_watcher.isFinished() ? m_watcher.result().statistics : SearchStatistics();
+}
+
+SearchProfile AnagramFinder::profile() const
+{
+    return m_watcher.isFinished() ? m_watcher.result().profile : SearchProfile();
 }
 
 void AnagramFinder::slotStart()
 {
-    m_thread->start();
+    m_watcher.setFuture(SearchPool::instance()->submit(m_index, m_word, m_profile, m_stream, m_constraints));
 }
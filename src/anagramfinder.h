@@ -29,26 +29,29 @@
 #include <QtCore>
 
 #include "nonrejectabledialog.h"
+#include "dictionaryindex.h"
 #include "longestpaths.h"
-#include "anagrams.h"
+#include "searchpool.h"
 
 namespace Ui
 {
     class AnagramFinder;
 }
 
-class AnagramFinderThread;
-
 /*
- *  Dialog to block the UI while anagram search is in progress. Search is implemented
- *  in a separate thread (AnagramFinderThread)
+ *  Dialog to block the UI while anagram search is in progress. Search is executed
+ *  by one of the SearchPool workers
  */
 class AnagramFinder : public NonRejectableDialog
 {
     Q_OBJECT
 
 public:
-    explicit AnagramFinder(const Anagrams &anagrams, const QString &word, QWidget *parent = nullptr);
+    AnagramFinder(const DictionaryIndex &index,
+                  const QString &word,
+                  const SearchConstraints &constraints,
+                  bool profile,
+                  QWidget *parent = nullptr);
     ~AnagramFinder();
 
     /*
@@ -61,12 +64,38 @@ public:
      */
     qint64 algorithmTime() const;
 
+    /*
+     *  Counters of the search
+     */
+    SearchStatistics statistics() const;
+
+    /*
+     *  Profile of the search, empty if the search has not been profiled
+     */
+    SearchProfile profile() const;
+
+    /*
+     *  Chains found so far, while the search is running
+     */
+    inline
+    QSharedPointer<ChainStream> chainStream() const;
+
 private slots:
     void slotStart();
 
 private:
     Ui::AnagramFinder *ui;
-    AnagramFinderThread *m_thread;
+    DictionaryIndex m_index;
+    QString m_word;
+    SearchConstraints m_constraints;
+    bool m_profile;
+    QSharedPointer<ChainStream> m_stream;
+    QFutureWatcher<QueryResult> m_watcher;
 };
 
+QSharedPointer<ChainStream> AnagramFinder::chainStream() const
+{
+    return m_stream;
+}
+
 #endif // ANAGRAMFINDER_H
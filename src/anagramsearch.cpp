@@ -0,0 +1,777 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "anagramsearch.h"
+#include "sortedkey.h"
+#include "keytrie.h"
+#include "tracer.h"
+
+namespace
+{
+
+// number of expanded words between two cancel checks
+constexpr int CANCEL_CHECK_INTERVAL = 1024;
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+/*
+ *  Open addressing set of words. Words are stored in the index only once, so
+ *  we can compare their addresses instead of their characters. Every word also
+ *  keeps the deepest position in a chain it has been inserted with
+ */
+class WordSet
+{
+    struct Entry
+    {
+        const char *word;
+        int depth;
+    };
+
+public:
+    explicit WordSet(MonotonicArena *arena)
+        : m_arena(arena)
+        , m_table(nullptr)
+        , m_mask(0)
+        , m_size(0)
+    {
+        allocate(64);
+    }
+
+    /*
+     *  The word has been inserted with the depth or deeper
+     */
+    bool contains(const char *word, int depth = 0) const
+    {
+        for(std::size_t i = slot(word);m_table[i].word;i = (i + 1) & m_mask)
+        {
+            if(m_table[i].word == word)
+                return m_table[i].depth >= depth;
+        }
+
+        return false;
+    }
+
+    /*
+     *  Returns false if the word is already in the set
+     */
+    bool insert(const char *word, int depth = 0)
+    {
+        // keep the load factor at 0.5 or lower
+        if((m_size + 1) * 2 > m_mask + 1)
+            grow();
+
+        std::size_t i = slot(word);
+
+        for(;m_table[i].word;i = (i + 1) & m_mask)
+        {
+            if(m_table[i].word == word)
+            {
+                m_table[i].depth = std::max(m_table[i].depth, depth);
+                return false;
+            }
+        }
+
+        m_table[i] = { word, depth };
+        m_size++;
+
+        return true;
+    }
+
+    std::size_t memorySize() const
+    {
+        return (m_mask + 1) * sizeof(Entry);
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    void clear()
+    {
+        std::memset(m_table, 0, (m_mask + 1) * sizeof(Entry));
+        m_size = 0;
+    }
+
+private:
+    std::size_t slot(const char *word) const
+    {
+        // Fibonacci hashing of the address
+        return static_cast<std::size_t>((reinterpret_cast<std::uintptr_t>(word) * 0x9E3779B97F4A7C15ull) >> 20) & m_mask;
+    }
+
+    void allocate(std::size_t capacity)
+    {
+        m_table = static_cast<Entry *>(m_arena->allocate(capacity * sizeof(Entry), alignof(Entry)));
+        std::memset(m_table, 0, capacity * sizeof(Entry));
+        m_mask = capacity - 1;
+    }
+
+    void grow()
+    {
+        // the old table stays in the arena until the query finishes
+        const Entry *oldTable = m_table;
+        const std::size_t oldCapacity = m_mask + 1;
+
+        allocate(oldCapacity * 2);
+
+        for(std::size_t i = 0;i < oldCapacity;i++)
+        {
+            if(!oldTable[i].word)
+                continue;
+
+            std::size_t j = slot(oldTable[i].word);
+
+            while(m_table[j].word)
+                j = (j + 1) & m_mask;
+
+            m_table[j] = oldTable[i];
+        }
+    }
+
+private:
+    MonotonicArena *m_arena;
+    Entry *m_table;
+    std::size_t m_mask;
+    std::size_t m_size;
+};
+
+}
+
+/*
+ *  State of a single query. Every container allocates from the arena
+ */
+class AnagramSearch::Query
+{
+public:
+    Query(const DictionaryIndex &index,
+          MonotonicArena *arena,
+          int seedLength,
+          bool profiling,
+          ChainStream *stream,
+          const std::function<bool()> &isCanceled,
+          const SearchConstraints &constraints)
+        : m_index(index)
+        , m_arena(arena)
+        , m_seedLength(seedLength)
+        , m_stream(stream)
+        , m_isCanceled(isCanceled)
+        , m_cancelCountdown(CANCEL_CHECK_INTERVAL)
+        , m_canceled(false)
+        , m_required(constraints.required())
+        , m_maxLength(constraints.maxLength > 0 ? constraints.maxLength : 0)
+        , m_lengthLimit(m_maxLength > 0 ? std::min(m_maxLength, index.maxWordLength()) : index.maxWordLength())
+        , m_maxStep(std::max(1, constraints.maxStep))
+        , m_trie(m_maxStep > 1 ? &index.trie() : nullptr)
+        , m_path(ArenaAllocator<PathWord>(arena))
+        , m_longestPaths(ArenaAllocator<PathWord>(arena))
+        , m_longestSteps(0)
+        , m_longestAnagrams(arena)
+        , m_splittedPaths(arena)
+        , m_keyBuffers(ArenaAllocator<char *>(arena))
+        , m_depths(ArenaAllocator<DepthStatistics>(arena))
+        , m_chains(0)
+        , m_newLongest(0)
+        , m_peakChains(0)
+        , m_profiling(profiling)
+        , m_depthTimes(ArenaAllocator<qint64>(arena))
+        , m_keyProfiles(16,
+                        std::hash<const char *>(),
+                        std::equal_to<const char *>(),
+                        ArenaAllocator<std::pair<const char * const, KeyProfile>>(arena))
+    {
+        // reduce allocations a little bit
+        m_path.reserve(32);
+
+        // the excluded letters are never added
+        const std::string excluded = constraints.excluded();
+        char *letter = m_alphabet;
+
+        for(const char *alphabetIndex = alphabet;*alphabetIndex;alphabetIndex++)
+        {
+            if(!std::binary_search(excluded.begin(), excluded.end(), *alphabetIndex))
+                *letter++ = *alphabetIndex;
+        }
+
+        *letter = '\0';
+
+        if(m_profiling)
+            m_timer.start();
+    }
+
+    /*
+     *  Expand the word, and measure the time of the expansion when profiling
+     */
+    void findAnagrams(const char *word, int length);
+
+    /*
+     *  Expand the starting word with blanks. Every blank stands for any letter, so the first
+     *  words of the chains are all the keys containing the letters plus the blanks plus the
+     *  letters of the first step. They are found in a single walk of the key trie instead
+     *  of a search per substitution, and the searches from them share the caches
+     */
+    void findWildcardAnagrams(const char *letters, int length, int blanks);
+
+    LongestPaths longestPaths() const;
+
+    void statistics(SearchStatistics *statistics) const;
+
+    void profile(SearchProfile *profile) const;
+
+    inline
+    bool isCanceled() const
+    {
+        return m_canceled;
+    }
+
+private:
+    /*
+     *  Add every letter to the word and dive into the found groups
+     */
+    void expand(const char *word, int length);
+
+    /*
+     *  Walk the group found from a word of the depth: update the longest chains
+     *  and dive into the group
+     */
+    void visit(const DictionaryIndex::Group &anagrams, std::size_t depth);
+
+    /*
+     *  Scratch buffer for the keys of the specified length
+     */
+    char *keyBuffer(int length);
+
+    /*
+     *  Save m_path into m_longestPaths and split it into m_splittedPaths
+     */
+    void cacheCurrentPath();
+
+    /*
+     *  Number of the required letters missing in the sorted word
+     */
+    int missingLetters(const char *word, int length) const;
+
+private:
+    const DictionaryIndex &m_index;
+    MonotonicArena *m_arena;
+    const int m_seedLength;
+    // optional consumer of the chains while the search is running
+    ChainStream *m_stream;
+    // optional cancel check, called once per CANCEL_CHECK_INTERVAL expansions
+    const std::function<bool()> &m_isCanceled;
+    int m_cancelCountdown;
+    bool m_canceled;
+    // constraints: the letters to add, the sorted required letters, the maximum
+    // length of the words (0 is no limit), and the length no word can exceed
+    char m_alphabet[alphabetSize + 1];
+    const std::string m_required;
+    const int m_maxLength;
+    const int m_lengthLimit;
+    // the maximum number of letters added per step, and the trie to add more than one
+    const int m_maxStep;
+    const KeyTrie *m_trie;
+    // current chain. Words point into the index
+    struct PathWord
+    {
+        const char *word;
+        int length;
+    };
+
+    ArenaVector<PathWord> m_path;
+    // all longest chains found, stored one by one since they have the same length
+    ArenaVector<PathWord> m_longestPaths;
+    // the number of words in the chains in m_longestPaths
+    int m_longestSteps;
+    // the last words of the chains in m_longestPaths
+    WordSet m_longestAnagrams;
+    // splitted unique parts of m_longestPaths with their positions (for performance optimization)
+    WordSet m_splittedPaths;
+    // keys to probe the index, one buffer per length
+    ArenaVector<char *> m_keyBuffers;
+    // counters
+    ArenaVector<DepthStatistics> m_depths;
+    qint64 m_chains;
+    qint64 m_newLongest;
+    qint64 m_peakChains;
+    // profiling
+    struct KeyProfile
+    {
+        int length;
+        qint64 expansions;
+        qint64 totalNs;
+    };
+
+    const bool m_profiling;
+    QElapsedTimer m_timer;
+    // time spent at the depth and below
+    ArenaVector<qint64> m_depthTimes;
+    // keys point into the index, so we compare their addresses
+    std::unordered_map<const char *, KeyProfile, std::hash<const char *>, std::equal_to<const char *>,
+                       ArenaAllocator<std::pair<const char * const, KeyProfile>>> m_keyProfiles;
+};
+
+void AnagramSearch::Query::findAnagrams(const char *word, int length)
+{
+    if(!m_profiling)
+    {
+        expand(word, length);
+        return;
+    }
+
+    const qint64 start = m_timer.nsecsElapsed();
+
+    expand(word, length);
+
+    const qint64 elapsed = m_timer.nsecsElapsed() - start;
+    const std::size_t depth = m_path.size();
+
+    if(m_depthTimes.size() <= depth)
+        m_depthTimes.resize(depth + 1, 0);
+
+    m_depthTimes[depth] += elapsed;
+
+    // the starting word is not in the index
+    if(depth > 0)
+    {
+        KeyProfile &keyProfile = m_keyProfiles[word];
+
+        keyProfile.length = length;
+        keyProfile.expansions++;
+        keyProfile.totalNs += elapsed;
+    }
+}
+
+void AnagramSearch::Query::expand(const char *word, int length)
+{
+    if(m_isCanceled && --m_cancelCountdown <= 0)
+    {
+        m_cancelCountdown = CANCEL_CHECK_INTERVAL;
+        m_canceled = m_isCanceled();
+    }
+
+    // unwind the recursion as fast as possible
+    if(m_canceled)
+        return;
+
+    // the longer words are not allowed
+    if(m_maxLength > 0 && length >= m_maxLength)
+        return;
+
+    // the word is too long to add all the missing required letters
+    if(!m_required.empty() && length + missingLetters(word, length) > m_lengthLimit)
+        return;
+
+    char *key = keyBuffer(length + 1);
+    const char *alphabetIndex = m_alphabet;
+    const std::size_t depth = m_path.size();
+
+    if(m_depths.size() <= depth)
+        m_depths.resize(depth + 1);
+
+    m_depths[depth].nodes++;
+
+    while(*alphabetIndex)
+    {
+        insertIntoSortedKey(word, length, *alphabetIndex++, key);
+
+        // add a single character from the alphabet and find its anagrams. Repeat the search
+        // recursively with the first anagram. When recursion has finished, return here and add
+        // the next character from the alphabet and find its anagrams etc.
+        const DictionaryIndex::Group anagrams = m_index.group(key, length + 1);
+
+        // the vector may be reallocated by the recursion, so don't keep references to it
+        m_depths[depth].probes++;
+
+        if(!anagrams.isEmpty())
+            m_depths[depth].hits++;
+
+        visit(anagrams, depth);
+    }
+
+    // the longer steps. Every step length is a single walk of the trie
+    // instead of probing every combination of letters
+    for(int extra = 2;extra <= m_maxStep && (m_maxLength <= 0 || length + extra <= m_maxLength);extra++)
+    {
+        m_depths[depth].probes++;
+
+        m_trie->forEachSuperset(word, length, extra, m_alphabet, [this, depth](const DictionaryIndex::Group &anagrams) {
+            m_depths[depth].hits++;
+            visit(anagrams, depth);
+        });
+    }
+}
+
+void AnagramSearch::Query::visit(const DictionaryIndex::Group &anagrams, std::size_t depth)
+{
+    if(anagrams.isEmpty())
+        return;
+
+    // the anagrams have the same letters, so they all end a chain
+    // satisfying the required letters or they all don't
+    const bool accepted = m_required.empty() || !missingLetters(anagrams.key(), anagrams.wordLength());
+    const int steps = static_cast<int>(depth) + 1;
+
+    for(int i = 0;i < anagrams.size();i++)
+    {
+        const char *anagram = anagrams.word(i);
+        const int anagramLength = anagrams.wordLength();
+        bool dive = true;
+
+        m_path.push_back({ anagram, anagramLength });
+
+        // longest chain - update the cache with it. We can check the length only
+        // of the first anagram
+        if(accepted && i == 0 && steps > m_longestSteps)
+        {
+            m_longestPaths.clear();
+            m_longestAnagrams.clear();
+            m_splittedPaths.clear();
+            m_longestSteps = steps;
+            m_chains = 0;
+            m_newLongest++;
+
+            if(m_stream)
+                m_stream->reset();
+
+            m_longestAnagrams.insert(anagram);
+            cacheCurrentPath();
+        }
+        // check if we need to cache the chain with the same length
+        else if(accepted && steps == m_longestSteps)
+        {
+            // cache a new longest anagram with its chain
+            if(m_longestAnagrams.insert(anagram))
+                cacheCurrentPath();
+        }
+        // since we allow recursion for the first anagram only, allow cache checking
+        // for the first anagram too
+        else if(i == 0)
+        {
+            // the anagram is not the longest anagram currently found, and it is presented
+            // somewhere in the cached longest chains, so we just ignore it and don't dive
+            // into recursion to avoid a duplicate path walk. With the longer steps the anagram
+            // may be reached in fewer steps, and then its chains cannot be the longest ones
+            if(m_splittedPaths.contains(anagram, steps))
+            {
+                dive = false;
+                m_depths[depth].skipped++;
+            }
+        }
+
+        /*
+         *  dive deeper for the first anagram only. We use the first anagram only because
+         *  we walk the same way for the rest of them, e.g.
+         *
+         *               anagrams   sort   sorted
+         *                  ↓        ↓       ↓
+         *   owl + a +---> awol --------+-> alow + a -> ...
+         *           |                  +-> alow + b -> ...
+         *           |                  +-> alow + c -> ...
+         *           |
+         *           +---> wola --------+-> alow + a -> ... DUPLICATE!
+         *           |                  +-> alow + b -> ... DUPLICATE!
+         *           |                  +-> alow + c -> ... DUPLICATE!
+         *           |
+         *           +---> lowa --------+-> alow + a -> ... DUPLICATE!
+         *                              +-> alow + b -> ... DUPLICATE!
+         *                              +-> alow + c -> ... DUPLICATE!
+         *   owl + b +---> ...
+         *
+         *  This is why we can reduce the unnecessary path walks to
+         *
+         *   owl + a +---> awol --------+-> alow + a -> ...
+         *           |                  +-> alow + b -> ...
+         *           |                  +-> alow + c -> ...
+         *           +---> wola
+         *           +---> lowa
+         *
+         *   owl + b +---> ...
+         *
+         *  The sorted anagram is the key of the group, so we don't need to sort it again
+         */
+        if(i == 0 && dive)
+            findAnagrams(anagrams.key(), anagramLength);
+
+        m_path.pop_back();
+    }
+}
+
+void AnagramSearch::Query::findWildcardAnagrams(const char *letters, int length, int blanks)
+{
+    const qint64 start = m_profiling ? m_timer.nsecsElapsed() : 0;
+
+    // the starting word with the blanks is at depth 0
+    m_depths.resize(1);
+    m_depths[0].nodes++;
+
+    const bool allowed = m_required.empty() || m_seedLength + std::max(0, missingLetters(letters, length) - blanks) <= m_lengthLimit;
+
+    // a single structured probe per step length instead of 26^(blanks + 1) probes
+    for(int extra = blanks + 1;allowed && extra <= blanks + m_maxStep && (m_maxLength <= 0 || length + extra <= m_maxLength);extra++)
+    {
+        m_depths[0].probes++;
+
+        m_index.trie().forEachSuperset(letters, length, extra, m_alphabet, [this](const DictionaryIndex::Group &anagrams) {
+            m_depths[0].hits++;
+            visit(anagrams, 0);
+        });
+    }
+
+    if(m_profiling)
+    {
+        m_depthTimes.resize(std::max<std::size_t>(m_depthTimes.size(), 1), 0);
+        m_depthTimes[0] += m_timer.nsecsElapsed() - start;
+    }
+}
+
+LongestPaths AnagramSearch::Query::longestPaths() const
+{
+    LongestPaths result;
+
+    const std::size_t pathLength = m_longestSteps;
+
+    if(!pathLength)
+        return result;
+
+    for(std::size_t i = 0;i < m_longestPaths.size();i += pathLength)
+    {
+        LongestPath path;
+        path.reserve(static_cast<int>(pathLength));
+
+        for(std::size_t j = 0;j < pathLength;j++)
+            path.push(std::string(m_longestPaths[i + j].word, m_longestPaths[i + j].length));
+
+        result.append(path);
+    }
+
+    return result;
+}
+
+void AnagramSearch::Query::statistics(SearchStatistics *statistics) const
+{
+    statistics->newLongest = m_newLongest;
+    statistics->peakChains = m_peakChains;
+
+    std::size_t keyBuffers = m_keyBuffers.capacity() * sizeof(char *);
+
+    for(std::size_t length = 0;length < m_keyBuffers.size();length++)
+    {
+        if(m_keyBuffers[length])
+            keyBuffers += length;
+    }
+
+    statistics->memory = MemoryUsage();
+    statistics->memory.add("current chain", m_path.capacity() * sizeof(PathWord), m_path.size());
+    statistics->memory.add("longest chains", m_longestPaths.capacity() * sizeof(PathWord), m_longestPaths.size());
+    statistics->memory.add("longest words set", m_longestAnagrams.memorySize(), m_longestAnagrams.size());
+    statistics->memory.add("path cache", m_splittedPaths.memorySize(), m_splittedPaths.size());
+    statistics->memory.add("key buffers", keyBuffers);
+    statistics->memory.add("counters", m_depths.capacity() * sizeof(DepthStatistics), m_depths.size());
+    // everything above lives in the arena. The rest of the arena is the old tables
+    // and vectors left after growing, and the free space of the blocks
+    statistics->memory.add("arena overhead", std::max<qint64>(0, static_cast<qint64>(m_arena->reservedSize()) - statistics->memory.total()));
+    statistics->depths.clear();
+    statistics->depths.reserve(static_cast<int>(m_depths.size()));
+
+    for(const DepthStatistics &depth : m_depths)
+        statistics->depths.append(depth);
+}
+
+void AnagramSearch::Query::profile(SearchProfile *profile) const
+{
+    profile->depths.clear();
+    profile->totalNs = m_depthTimes.empty() ? 0 : m_depthTimes.front();
+
+    for(std::size_t depth = 0;depth < m_depthTimes.size();depth++)
+    {
+        SearchProfile::Depth result;
+
+        result.nodes = depth < m_depths.size() ? m_depths[depth].nodes : 0;
+        result.totalNs = m_depthTimes[depth];
+        // every word of the next depth is expanded inside of a word of this depth
+        result.selfNs = m_depthTimes[depth] - (depth + 1 < m_depthTimes.size() ? m_depthTimes[depth + 1] : 0);
+
+        profile->depths.append(result);
+    }
+
+    std::vector<SearchProfile::Key> keys;
+    keys.reserve(m_keyProfiles.size());
+
+    profile->distinctKeys = static_cast<qint64>(m_keyProfiles.size());
+    profile->repeatedExpansions = 0;
+    profile->repeatedNs = 0;
+
+    for(const auto &keyProfile : m_keyProfiles)
+    {
+        const KeyProfile &value = keyProfile.second;
+
+        keys.push_back({ std::string(keyProfile.first, value.length), value.expansions, value.totalNs });
+
+        profile->repeatedExpansions += value.expansions - 1;
+        profile->repeatedNs += value.totalNs * (value.expansions - 1) / value.expansions;
+    }
+
+    const std::size_t top = std::min(keys.size(), static_cast<std::size_t>(std::max(0, profile->topKeys)));
+
+    std::partial_sort(keys.begin(), keys.begin() + top, keys.end(), [](const SearchProfile::Key &a, const SearchProfile::Key &b) {
+        return a.totalNs > b.totalNs;
+    });
+
+    profile->keysByTime.clear();
+
+    for(std::size_t i = 0;i < top;i++)
+        profile->keysByTime.append(keys[i]);
+
+    std::partial_sort(keys.begin(), keys.begin() + top, keys.end(), [](const SearchProfile::Key &a, const SearchProfile::Key &b) {
+        return a.expansions > b.expansions || (a.expansions == b.expansions && a.totalNs > b.totalNs);
+    });
+
+    profile->keysByExpansions.clear();
+
+    for(std::size_t i = 0;i < top;i++)
+        profile->keysByExpansions.append(keys[i]);
+}
+
+char *AnagramSearch::Query::keyBuffer(int length)
+{
+    if(m_keyBuffers.size() <= static_cast<std::size_t>(length))
+        m_keyBuffers.resize(length + 1, nullptr);
+
+    char *&buffer = m_keyBuffers[length];
+
+    if(!buffer)
+        buffer = static_cast<char *>(m_arena->allocate(length, 1));
+
+    return buffer;
+}
+
+int AnagramSearch::Query::missingLetters(const char *word, int length) const
+{
+    const char *end = word + length;
+    int missing = 0;
+
+    // both are sorted, so merge them
+    for(const char letter : m_required)
+    {
+        while(word != end && *word < letter)
+            word++;
+
+        if(word != end && *word == letter)
+            word++;
+        else
+            missing++;
+    }
+
+    return missing;
+}
+
+void AnagramSearch::Query::cacheCurrentPath()
+{
+    m_longestPaths.insert(m_longestPaths.end(), m_path.begin(), m_path.end());
+
+    for(std::size_t i = 0;i < m_path.size();i++)
+        m_splittedPaths.insert(m_path[i].word, static_cast<int>(i) + 1);
+
+    m_peakChains = std::max(m_peakChains, ++m_chains);
+
+    if(m_stream)
+    {
+        LongestPath path;
+        path.reserve(static_cast<int>(m_path.size()));
+
+        for(std::size_t i = 0;i < m_path.size();i++)
+            path.push(std::string(m_path[i].word, m_path[i].length));
+
+        m_stream->append(path);
+    }
+}
+
+constexpr char AnagramSearch::BLANK;
+
+AnagramSearch::AnagramSearch(const DictionaryIndex &index)
+    : m_index(index)
+    , m_canceled(false)
+{}
+
+void AnagramSearch::setCancelCheck(const std::function<bool()> &isCanceled)
+{
+    m_isCanceled = isCanceled;
+}
+
+void AnagramSearch::setConstraints(const SearchConstraints &constraints)
+{
+    m_constraints = constraints;
+}
+
+LongestPaths AnagramSearch::find(const QString &word, SearchStatistics *statistics, SearchProfile *profile, ChainStream *stream)
+{
+    TraceSpan span("search", [&word] { return word; });
+
+    // sort the word now to save CPU time later. The blanks are sorted before the letters
+    std::string sortedWord = word.toLower().toStdString();
+    std::sort(sortedWord.begin(), sortedWord.end());
+
+    const int blanks = static_cast<int>(std::count(sortedWord.begin(), sortedWord.end(), BLANK));
+    const char *letters = sortedWord.c_str() + blanks;
+    const int length = static_cast<int>(sortedWord.length()) - blanks;
+
+    LongestPaths result;
+
+    {
+        // the blanks are counted in the length of the starting word
+        Query query(m_index, &m_arena, length + blanks, profile != nullptr, stream, m_isCanceled, m_constraints);
+
+        if(blanks)
+            query.findWildcardAnagrams(letters, length, blanks);
+        else
+            query.findAnagrams(letters, length);
+
+        // the chains of a canceled search are not the longest ones
+        m_canceled = query.isCanceled();
+
+        if(!m_canceled)
+            result = query.longestPaths();
+
+        if(statistics)
+        {
+            query.statistics(statistics);
+            statistics->memory.add("results: ", MemoryUsage::ofPaths(result));
+        }
+
+        if(profile)
+            query.profile(profile);
+    }
+
+    // all the temporary state of the query goes away at once
+    m_arena.release();
+
+    return result;
+}
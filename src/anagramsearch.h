@@ -0,0 +1,105 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef ANAGRAMSEARCH_H
+#define ANAGRAMSEARCH_H
+
+#include "dictionaryindex.h"
+#include "chainstream.h"
+#include "longestpaths.h"
+#include "monotonicarena.h"
+#include "searchconstraints.h"
+#include "searchstatistics.h"
+#include "searchprofile.h"
+
+#include <functional>
+
+/*
+ *  The search algorithm. The index is immutable and shared, and all the temporary state
+ *  of a query (current chain, found chains, caches) lives in a per-query arena released
+ *  in one shot when the query finishes. Any number of AnagramSearch objects may run
+ *  concurrently against the same index, one object per thread
+ */
+class AnagramSearch
+{
+public:
+    // the blank in the starting word stands for any letter
+    static constexpr char BLANK = '?';
+
+    explicit AnagramSearch(const DictionaryIndex &index);
+
+    /*
+     *  Find the longest chains of anagram derivations starting with the word. Result
+     *  is a list of chains like that:
+     *
+     *  owl -> lowe -> ...
+     *  owl -> awol -> ...
+     *
+     *  The starting word is not included in the chains. It may contain blanks ("ow?"),
+     *  then the chains of all the substitutions are searched at once. The counters of the search
+     *  are saved into 'statistics' if it's not null. The search is profiled if 'profile'
+     *  is not null, which makes it slower. The chains are also appended to 'stream' as soon
+     *  as they are found if it's not null
+     */
+    LongestPaths find(const QString &word,
+                      SearchStatistics *statistics = nullptr,
+                      SearchProfile *profile = nullptr,
+                      ChainStream *stream = nullptr);
+
+    /*
+     *  The callback is called from time to time during the search. When it returns true,
+     *  the search stops and find() returns an empty result
+     */
+    void setCancelCheck(const std::function<bool()> &isCanceled);
+
+    /*
+     *  Constraints of the next searches. The search finds the longest chains
+     *  satisfying them
+     */
+    void setConstraints(const SearchConstraints &constraints);
+
+    /*
+     *  The last search has been stopped by the cancel check
+     */
+    inline
+    bool isCanceled() const;
+
+private:
+    class Query;
+
+private:
+    DictionaryIndex m_index;
+    MonotonicArena m_arena;
+    std::function<bool()> m_isCanceled;
+    bool m_canceled;
+    SearchConstraints m_constraints;
+};
+
+bool AnagramSearch::isCanceled() const
+{
+    return m_canceled;
+}
+
+#endif // ANAGRAMSEARCH_H
@@ -0,0 +1,202 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "bulklookup.h"
+#include "sortedkey.h"
+#include "tracer.h"
+
+namespace
+{
+
+// words whose keys are built together. The count arrays of a letter fit into a vector register or two
+constexpr int BATCH_SIZE = 32;
+
+// longer words are rare, their keys are built one by one not to widen the whole batch
+constexpr int MAX_BATCH_WORD_LENGTH = 32;
+
+// letter index of the positions past the end of a shorter word
+constexpr quint8 NO_LETTER = alphabetSize;
+
+// letter index of the characters other than Latin letters
+constexpr quint8 INVALID_LETTER = alphabetSize + 1;
+
+}
+
+BulkLookup::BulkLookup(const DictionaryIndex &index)
+    : m_index(index)
+{
+    std::fill(m_letterIndex, m_letterIndex + 256, INVALID_LETTER);
+
+    for(int i = 0;i < alphabetSize;i++)
+    {
+        m_letterIndex[static_cast<unsigned char>(alphabet[i])] = i;
+        m_letterIndex[static_cast<unsigned char>(std::toupper(alphabet[i]))] = i;
+    }
+}
+
+QVector<DictionaryIndex::Group> BulkLookup::find(const QList<QByteArray> &words)
+{
+    TraceSpan span("bulk-lookup", [&words] { return QString::number(words.size()); });
+
+    QVector<DictionaryIndex::Group> result(words.size());
+
+    if(words.isEmpty())
+        return result;
+
+    std::string::size_type total = 0;
+
+    for(const QByteArray &word : words)
+        total += word.size();
+
+    m_keys.resize(total);
+    m_keyPointers.resize(words.size());
+    m_lengths.resize(words.size());
+
+    char *key = &m_keys[0];
+
+    for(int i = 0;i < words.size();i++)
+    {
+        m_keyPointers[i] = key;
+        key += words.at(i).size();
+    }
+
+    for(int begin = 0;begin < words.size();begin += BATCH_SIZE)
+        buildKeys(words, begin, std::min(words.size(), begin + BATCH_SIZE));
+
+    m_index.groups(m_keyPointers.data(), m_lengths.data(), words.size(), result.data());
+
+    return result;
+}
+
+void BulkLookup::buildKeys(const QList<QByteArray> &words, int begin, int end)
+{
+    // letter indexes of the batch, a column per word. The unused cells are NO_LETTER
+    quint8 letters[MAX_BATCH_WORD_LENGTH][BATCH_SIZE];
+    int maxLength = 0;
+
+    for(int i = begin;i < end;i++)
+    {
+        const int length = words.at(i).size();
+
+        if(length <= MAX_BATCH_WORD_LENGTH)
+            maxLength = std::max(maxLength, length);
+    }
+
+    std::memset(letters, NO_LETTER, sizeof(letters[0]) * maxLength);
+
+    for(int i = begin;i < end;i++)
+    {
+        const QByteArray &word = words.at(i);
+
+        // the words with invalid characters are looked up as empty keys, which are never in the index
+        if(word.size() > MAX_BATCH_WORD_LENGTH)
+        {
+            m_lengths[i] = sortedKey(word, m_keyPointers[i]) ? word.size() : 0;
+            continue;
+        }
+
+        const char *data = word.constData();
+
+        for(int position = 0;position < word.size();position++)
+            letters[position][i - begin] = m_letterIndex[static_cast<unsigned char>(data[position])];
+    }
+
+    // all the loops below go over the whole batch with no branches
+    quint8 invalid[BATCH_SIZE] = {};
+
+    for(int position = 0;position < maxLength;position++)
+    {
+        for(int lane = 0;lane < BATCH_SIZE;lane++)
+            invalid[lane] |= letters[position][lane] == INVALID_LETTER;
+    }
+
+    // number of the letters up to the letter inclusive, it's where the letter ends in the key
+    quint8 letterEnds[alphabetSize][BATCH_SIZE];
+    quint8 counts[BATCH_SIZE] = {};
+
+    for(int letter = 0;letter < alphabetSize;letter++)
+    {
+        for(int position = 0;position < maxLength;position++)
+        {
+            for(int lane = 0;lane < BATCH_SIZE;lane++)
+                counts[lane] += letters[position][lane] == letter;
+        }
+
+        std::memcpy(letterEnds[letter], counts, BATCH_SIZE);
+    }
+
+    // the letter at a position of the key is the number of the letters ending at or before the position
+    char keys[MAX_BATCH_WORD_LENGTH][BATCH_SIZE];
+
+    for(int position = 0;position < maxLength;position++)
+    {
+        quint8 letterAt[BATCH_SIZE] = {};
+
+        for(int letter = 0;letter < alphabetSize;letter++)
+        {
+            for(int lane = 0;lane < BATCH_SIZE;lane++)
+                letterAt[lane] += letterEnds[letter][lane] <= position;
+        }
+
+        // past the end of a word the index is alphabetSize, the terminating zero of the alphabet
+        for(int lane = 0;lane < BATCH_SIZE;lane++)
+            keys[position][lane] = alphabet[letterAt[lane]];
+    }
+
+    for(int i = begin;i < end;i++)
+    {
+        const int length = words.at(i).size();
+
+        if(length > MAX_BATCH_WORD_LENGTH)
+            continue;
+
+        char *key = m_keyPointers[i];
+
+        for(int position = 0;position < length;position++)
+            key[position] = keys[position][i - begin];
+
+        m_lengths[i] = invalid[i - begin] ? 0 : length;
+    }
+}
+
+bool BulkLookup::sortedKey(const QByteArray &word, char *key) const
+{
+    int counts[alphabetSize + 2] = {};
+
+    for(const char ch : word)
+        counts[m_letterIndex[static_cast<unsigned char>(ch)]]++;
+
+    if(counts[INVALID_LETTER])
+        return false;
+
+    for(int i = 0;i < alphabetSize;i++)
+        key = std::fill_n(key, counts[i], alphabet[i]);
+
+    return true;
+}
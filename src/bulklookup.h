@@ -0,0 +1,79 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef BULKLOOKUP_H
+#define BULKLOOKUP_H
+
+#include <string>
+#include <vector>
+
+#include "dictionaryindex.h"
+
+/*
+ *  Bulk lookup of the anagram groups of many words. The sorted keys are built for batches
+ *  of words at once: the letters of a batch are laid out column by column, one column per word,
+ *  and counted with per-letter count arrays, so the inner loops go across the words of the batch
+ *  with no branches, and the compiler vectorizes them. The keys are then looked up in the index
+ *  together, so the cache misses of the different words overlap instead of stalling one by one.
+ *  The buffers are reused between the calls. The index is shared, so every thread just needs its
+ *  own instance:
+ *
+ *  BulkLookup lookup(index);
+ *  QVector<DictionaryIndex::Group> groups = lookup.find(words);
+ */
+class BulkLookup
+{
+public:
+    explicit BulkLookup(const DictionaryIndex &index);
+
+    /*
+     *  The groups of the words in the same order. The words with characters other than
+     *  Latin letters, and the words not in the dictionary get an empty group
+     */
+    QVector<DictionaryIndex::Group> find(const QList<QByteArray> &words);
+
+private:
+    /*
+     *  Build the sorted keys of the words [begin, end) into the key buffer, and set their lengths
+     */
+    void buildKeys(const QList<QByteArray> &words, int begin, int end);
+
+    /*
+     *  Build the sorted key of a single word, for the words too long for a batch.
+     *  Returns false if the word has invalid characters
+     */
+    bool sortedKey(const QByteArray &word, char *key) const;
+
+private:
+    DictionaryIndex m_index;
+    // index of the letter in the alphabet by the character
+    quint8 m_letterIndex[256];
+    // keys of the words one after another
+    std::string m_keys;
+    std::vector<char *> m_keyPointers;
+    std::vector<int> m_lengths;
+};
+
+#endif // BULKLOOKUP_H
@@ -0,0 +1,170 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "chainenumerator.h"
+#include "sortedkey.h"
+
+ChainEnumerator::ChainEnumerator(const DictionaryIndex &index, const QString &word)
+    : m_index(index)
+    , m_word(word.toLower().toStdString())
+    , m_heights(64, std::hash<const char *>(), std::equal_to<const char *>(),
+                ArenaAllocator<std::pair<const char * const, int>>(&m_arena))
+    , m_rootHeight(-1)
+    , m_lastWord(0)
+    , m_finished(false)
+{
+    std::sort(m_word.begin(), m_word.end());
+}
+
+bool ChainEnumerator::next(LongestPath *chain)
+{
+    if(m_finished)
+        return false;
+
+    // first call, prove the optimality and start from the root
+    if(m_stack.empty() && m_lastGroup.isEmpty())
+    {
+        if(longestChainLength() == 0)
+        {
+            m_finished = true;
+            return false;
+        }
+
+        m_stack.push_back(Frame { m_word.c_str(), static_cast<int>(m_word.length()), m_rootHeight, 0, nullptr });
+    }
+
+    // the rest of the words in the last group
+    if(!m_lastGroup.isEmpty() && ++m_lastWord < m_lastGroup.size())
+    {
+        buildChain(chain);
+        return true;
+    }
+
+    m_lastGroup = DictionaryIndex::Group();
+
+    // walk only the children leading to the longest chains
+    while(!m_stack.empty())
+    {
+        Frame &frame = m_stack.back();
+
+        if(frame.letter == alphabetSize)
+        {
+            m_stack.pop_back();
+            continue;
+        }
+
+        const char *key = childKey(frame.key, frame.length, alphabet[frame.letter++]);
+        const DictionaryIndex::Group group = m_index.group(key, frame.length + 1);
+
+        if(group.isEmpty() || height(group) != frame.height - 1)
+            continue;
+
+        // reached the end of a longest chain
+        if(frame.height == 1)
+        {
+            m_lastGroup = group;
+            m_lastWord = 0;
+            buildChain(chain);
+            return true;
+        }
+
+        // 'frame' is invalidated here
+        m_stack.push_back(Frame { group.key(), group.wordLength(), frame.height - 1, 0, group.word(0) });
+    }
+
+    m_finished = true;
+    return false;
+}
+
+int ChainEnumerator::longestChainLength()
+{
+    if(m_rootHeight < 0)
+        m_rootHeight = height(m_word.c_str(), static_cast<int>(m_word.length()));
+
+    return m_rootHeight;
+}
+
+int ChainEnumerator::height(const char *key, int length)
+{
+    // no chain can be longer than the longest word
+    const int bound = m_index.maxWordLength() - length;
+    int best = 0;
+
+    for(int letter = 0;letter < alphabetSize && best < bound;letter++)
+    {
+        const DictionaryIndex::Group group = m_index.group(childKey(key, length, alphabet[letter]), length + 1);
+
+        if(!group.isEmpty())
+            best = std::max(best, height(group) + 1);
+    }
+
+    return best;
+}
+
+int ChainEnumerator::height(const DictionaryIndex::Group &group)
+{
+    auto it = m_heights.find(group.key());
+
+    if(it != m_heights.end())
+        return it->second;
+
+    const int result = height(group.key(), group.wordLength());
+    m_heights.insert(std::make_pair(group.key(), result));
+
+    return result;
+}
+
+const char *ChainEnumerator::childKey(const char *key, int length, char ch)
+{
+    if(m_keyBuffers.size() <= static_cast<std::size_t>(length + 1))
+        m_keyBuffers.resize(length + 2, nullptr);
+
+    char *&buffer = m_keyBuffers[length + 1];
+
+    if(!buffer)
+        buffer = static_cast<char *>(m_arena.allocate(length + 1, 1));
+
+    insertIntoSortedKey(key, length, ch, buffer);
+
+    return buffer;
+}
+
+void ChainEnumerator::buildChain(LongestPath *chain) const
+{
+    if(!chain)
+        return;
+
+    chain->clear();
+    chain->reserve(static_cast<int>(m_stack.size()));
+
+    // the root frame is the starting word itself
+    for(std::size_t i = 1;i < m_stack.size();i++)
+        chain->push(std::string(m_stack[i].word, m_stack[i].length));
+
+    chain->push(m_lastGroup.wordString(m_lastWord));
+}
@@ -0,0 +1,112 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef CHAINENUMERATOR_H
+#define CHAINENUMERATOR_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "dictionaryindex.h"
+#include "longestpaths.h"
+#include "monotonicarena.h"
+
+/*
+ *  Lazy pull-based enumeration of the longest chains. Chains are produced one by one
+ *  on demand in a stable order (letters from 'a' to 'z' at every step, then the words
+ *  of the last group in the dictionary order), and the work stops as soon as the
+ *  caller stops asking:
+ *
+ *  ChainEnumerator chains(index, "owl");
+ *  LongestPath chain;
+ *
+ *  while(chains.next(&chain))
+ *  {
+ *      ...
+ *  }
+ *
+ *  Unlike AnagramSearch, every route to the last word is reported, not only the first one.
+ *  The enumerator memoizes the height of every visited group (the length of the longest chain
+ *  starting with it), so asking for the first chain costs only what is needed to prove it
+ *  is the longest one, and the next chains reuse the work done
+ */
+class ChainEnumerator
+{
+public:
+    ChainEnumerator(const DictionaryIndex &index, const QString &word);
+
+    /*
+     *  Produce the next longest chain. Returns false when there are no more chains.
+     *  The starting word is not included in the chain
+     */
+    bool next(LongestPath *chain);
+
+    /*
+     *  Number of steps in the longest chains. Proves the optimality, but
+     *  doesn't enumerate anything
+     */
+    int longestChainLength();
+
+private:
+    struct Frame
+    {
+        const char *key;
+        int length;
+        int height;
+        int letter;
+        // the first word of the group we came to this frame through
+        const char *word;
+    };
+
+    /*
+     *  Length of the longest chain starting with the key
+     */
+    int height(const char *key, int length);
+    int height(const DictionaryIndex::Group &group);
+
+    /*
+     *  Insert the character into the sorted key
+     */
+    const char *childKey(const char *key, int length, char ch);
+
+    void buildChain(LongestPath *chain) const;
+
+private:
+    DictionaryIndex m_index;
+    std::string m_word;
+    MonotonicArena m_arena;
+    // key -> height. Keys point into the index, so we compare their addresses
+    std::unordered_map<const char *, int, std::hash<const char *>, std::equal_to<const char *>,
+                       ArenaAllocator<std::pair<const char * const, int>>> m_heights;
+    std::vector<Frame> m_stack;
+    std::vector<char *> m_keyBuffers;
+    int m_rootHeight;
+    // the last group of the current chain and the current word in it
+    DictionaryIndex::Group m_lastGroup;
+    int m_lastWord;
+    bool m_finished;
+};
+
+#endif // CHAINENUMERATOR_H
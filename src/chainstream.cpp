@@ -0,0 +1,70 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "chainstream.h"
+
+ChainStream::ChainStream()
+    : m_reset(false)
+    , m_count(0)
+{}
+
+void ChainStream::reset()
+{
+    QMutexLocker locker(&m_mutex);
+
+    // nobody has seen the pending chains yet, so they are just dropped
+    m_pending.clear();
+    m_reset = true;
+    m_count = 0;
+}
+
+void ChainStream::append(const LongestPath &path)
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_pending.append(path);
+    m_count++;
+}
+
+LongestPaths ChainStream::take(bool *reset)
+{
+    QMutexLocker locker(&m_mutex);
+
+    LongestPaths result;
+    result.swap(m_pending);
+
+    if(reset)
+        *reset = m_reset;
+
+    m_reset = false;
+
+    return result;
+}
+
+int ChainStream::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_count;
+}
@@ -0,0 +1,72 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef CHAINSTREAM_H
+#define CHAINSTREAM_H
+
+#include <QtCore>
+
+#include "longestpaths.h"
+
+/*
+ *  Chains found by a running search. The search thread appends the chains as soon as
+ *  they are found, and the consumer takes them in batches whenever it wants, for example
+ *  on a timer. When the search finds a longer chain, all the previous chains become obsolete,
+ *  and the stream is reset. Safe to use from two threads
+ */
+class ChainStream
+{
+public:
+    ChainStream();
+
+    /*
+     *  Called by the search. A longer chain has been found, forget the previous chains
+     */
+    void reset();
+
+    /*
+     *  Called by the search. A new chain has been found
+     */
+    void append(const LongestPath &path);
+
+    /*
+     *  Take the chains appended since the last call. 'reset' is set to true if the chains
+     *  taken before are obsolete and must be replaced with the returned ones
+     */
+    LongestPaths take(bool *reset);
+
+    /*
+     *  Number of the chains in the current generation, including the taken ones
+     */
+    int count() const;
+
+private:
+    mutable QMutex m_mutex;
+    LongestPaths m_pending;
+    bool m_reset;
+    int m_count;
+};
+
+#endif // CHAINSTREAM_H
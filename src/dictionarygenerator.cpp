@@ -0,0 +1,147 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "dictionarygenerator.h"
+#include "sortedkey.h"
+
+DictionaryGenerator::DictionaryGenerator(const Parameters &parameters)
+    : m_parameters(parameters)
+    , m_engine(parameters.seed)
+    , m_written(0)
+{
+    m_parameters.alphabetSize = qBound(1, m_parameters.alphabetSize, alphabetSize);
+    m_parameters.minLength = std::max(1, m_parameters.minLength);
+    m_parameters.maxLength = std::max(m_parameters.minLength, m_parameters.maxLength);
+    m_parameters.fanOut = std::max(0, m_parameters.fanOut);
+}
+
+bool DictionaryGenerator::generate(QIODevice *device)
+{
+    m_written = 0;
+    m_seeds.clear();
+
+    // planted chains first, they are usually a small part of the dictionary
+    for(int chain = 0;chain < m_parameters.chains && m_written < m_parameters.words;chain++)
+    {
+        std::string word;
+
+        for(int i = 0;i < m_parameters.minLength;i++)
+            word += randomLetter();
+
+        // the starting word itself doesn't have to be in the dictionary
+        m_seeds.append(QString::fromStdString(word));
+
+        // the chains never grow longer than 'maxLength'
+        for(int depth = 0;depth < m_parameters.chainDepth && static_cast<int>(word.length()) < m_parameters.maxLength;depth++)
+        {
+            word += randomLetter();
+
+            if(!writeGroup(device, randomPermutation(word)))
+                return false;
+        }
+    }
+
+    while(m_written < m_parameters.words)
+    {
+        const int length = randomLength();
+        std::string word;
+
+        for(int i = 0;i < length;i++)
+            word += randomLetter();
+
+        if(!writeGroup(device, word))
+            return false;
+    }
+
+    return true;
+}
+
+QByteArray DictionaryGenerator::generate()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    generate(&buffer);
+
+    return buffer.data();
+}
+
+int DictionaryGenerator::randomLength()
+{
+    // Irwin-Hall approximation of the normal distribution. std::normal_distribution
+    // is implementation-defined, so it would break the reproducibility
+    double sum = 0;
+
+    for(int i = 0;i < 4;i++)
+        sum += static_cast<double>(m_engine()) / m_engine.max();
+
+    // the sum has mean 2 and variance 1/3, scale it to cover the length range
+    const double spread = (m_parameters.maxLength - m_parameters.minLength) / 4.0;
+    const int length = static_cast<int>(m_parameters.meanLength + (sum - 2) * spread * 1.7320508 + 0.5);
+
+    return qBound(m_parameters.minLength, length, m_parameters.maxLength);
+}
+
+char DictionaryGenerator::randomLetter()
+{
+    return alphabet[m_engine() % m_parameters.alphabetSize];
+}
+
+std::string DictionaryGenerator::randomPermutation(const std::string &word)
+{
+    std::string result = word;
+
+    // Fisher-Yates. std::shuffle is implementation-defined too
+    for(int i = static_cast<int>(result.length()) - 1;i > 0;i--)
+        std::swap(result[i], result[m_engine() % (i + 1)]);
+
+    return result;
+}
+
+bool DictionaryGenerator::writeWord(QIODevice *device, const std::string &word)
+{
+    m_written++;
+
+    return device->write(word.c_str(), word.length()) == static_cast<qint64>(word.length())
+            && device->putChar('\n');
+}
+
+bool DictionaryGenerator::writeGroup(QIODevice *device, const std::string &word)
+{
+    if(!writeWord(device, word))
+        return false;
+
+    const int anagrams = static_cast<int>(m_engine() % (m_parameters.fanOut + 1));
+
+    for(int i = 0;i < anagrams && m_written < m_parameters.words;i++)
+    {
+        if(!writeWord(device, randomPermutation(word)))
+            return false;
+    }
+
+    return true;
+}
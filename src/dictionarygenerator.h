@@ -0,0 +1,118 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef DICTIONARYGENERATOR_H
+#define DICTIONARYGENERATOR_H
+
+#include <QtCore>
+
+#include <random>
+#include <string>
+
+/*
+ *  Generator of reproducible synthetic dictionaries for benchmarks and stress tests. The same
+ *  parameters produce the same dictionary on every platform. A dictionary consists of:
+ *
+ *  - random words with a normal length distribution, each word comes with up to 'fanOut'
+ *    anagrams to control the size of the anagram groups
+ *  - planted chains: 'chains' derivations 'chainDepth' steps deep starting from
+ *    a 'minLength' word, so the search always has deep paths to walk. A chain stops
+ *    earlier if its words would get longer than 'maxLength'
+ */
+class DictionaryGenerator
+{
+public:
+    struct Parameters
+    {
+        Parameters()
+            : seed(1)
+            , words(100000)
+            , minLength(3)
+            , maxLength(15)
+            , meanLength(8)
+            , alphabetSize(26)
+            , fanOut(3)
+            , chains(10)
+            , chainDepth(12)
+        {}
+
+        quint32 seed;
+        // total number of words (approximately, duplicates are possible)
+        qint64 words;
+        int minLength;
+        int maxLength;
+        double meanLength;
+        // use only the first N letters of the alphabet. Small alphabets produce huge anagram groups
+        int alphabetSize;
+        // maximum number of anagrams generated for a single word
+        int fanOut;
+        int chains;
+        int chainDepth;
+    };
+
+    explicit DictionaryGenerator(const Parameters &parameters);
+
+    /*
+     *  Write the dictionary line by line. Returns false on I/O errors
+     */
+    bool generate(QIODevice *device);
+
+    /*
+     *  The same as above, into memory
+     */
+    QByteArray generate();
+
+    /*
+     *  Starting words of the planted chains. Available after generate()
+     */
+    inline
+    QStringList seeds() const;
+
+private:
+    int randomLength();
+    char randomLetter();
+    std::string randomPermutation(const std::string &word);
+
+    bool writeWord(QIODevice *device, const std::string &word);
+
+    /*
+     *  Write the word and up to 'fanOut' of its anagrams
+     */
+    bool writeGroup(QIODevice *device, const std::string &word);
+
+private:
+    Parameters m_parameters;
+    // the engine is defined by the standard, unlike the distributions
+    std::mt19937 m_engine;
+    qint64 m_written;
+    QStringList m_seeds;
+};
+
+QStringList DictionaryGenerator::seeds() const
+{
+    return m_seeds;
+}
+
+#endif // DICTIONARYGENERATOR_H
@@ -0,0 +1,558 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "dictionaryindex.h"
+#include "keytrie.h"
+#include "tracer.h"
+
+namespace
+{
+
+// bump the version when the image layout changes
+constexpr char INDEX_MAGIC[8] = { 'A', 'N', 'A', 'G', 'I', 'D', 'X', '\0' };
+constexpr quint32 INDEX_VERSION = 2;
+
+struct IndexHeader
+{
+    char magic[8];
+    quint32 version;
+    quint32 keyCount;
+    quint32 wordCount;
+    quint32 bucketCount;
+    quint32 bucketsOffset;
+    quint32 recordsOffset;
+    quint32 maxWordLength;
+    quint32 reserved;
+    quint64 imageSize;
+    // file info of the source dictionary to detect outdated indexes
+    qint64 sourceSize;
+    qint64 sourceModified;
+    quint32 fingerprintSize;
+    char fingerprint[20];
+};
+
+static_assert(sizeof(IndexHeader) % 8 == 0, "The index header must keep the buckets aligned");
+
+// hash, key length, number of words
+constexpr int RECORD_HEADER_SIZE = 8;
+
+// keys looked up together by groups(). Enough to overlap the cache misses, and the hashes fit on the stack
+constexpr int LOOKUP_BATCH_SIZE = 32;
+
+/*
+ *  FNV-1a. Keys are short, so a simple byte-wise hash is fast enough
+ */
+inline
+quint32 hashKey(const char *key, int length)
+{
+    quint32 hash = 2166136261u;
+
+    for(int i = 0;i < length;i++)
+    {
+        hash ^= static_cast<unsigned char>(key[i]);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/*
+ *  Hint the CPU to start loading the cache line. Does nothing on the compilers without the builtin
+ */
+inline
+void prefetch(const void *address)
+{
+#if defined(Q_CC_GNU) || defined(Q_CC_CLANG)
+    __builtin_prefetch(address);
+#else
+    Q_UNUSED(address)
+#endif
+}
+
+inline
+quint64 recordSize(int length, int count)
+{
+    // keep the records aligned to 4 bytes
+    return (RECORD_HEADER_SIZE + static_cast<quint64>(length) * (count + 1) + 3) & ~static_cast<quint64>(3);
+}
+
+inline
+const IndexHeader *headerOf(const char *data)
+{
+    return reinterpret_cast<const IndexHeader *>(data);
+}
+
+/*
+ *  Group stored at the specified offset, or an empty group if the record is out of bounds
+ */
+DictionaryIndex::Group groupAt(const char *data, qint64 size, quint32 offset)
+{
+    if(offset < sizeof(IndexHeader) || offset + static_cast<qint64>(RECORD_HEADER_SIZE) > size)
+        return DictionaryIndex::Group();
+
+    const char *record = data + offset;
+    const quint16 length = *reinterpret_cast<const quint16 *>(record + 4);
+    const quint16 count = *reinterpret_cast<const quint16 *>(record + 6);
+
+    if(offset + static_cast<qint64>(recordSize(length, count)) > size)
+        return DictionaryIndex::Group();
+
+    return DictionaryIndex::Group(record + RECORD_HEADER_SIZE, length, count);
+}
+
+/*
+ *  Find the group by its sorted key and the hash of the key
+ */
+DictionaryIndex::Group findGroup(const char *data, qint64 size, const char *key, int length, quint32 hash)
+{
+    const IndexHeader *header = headerOf(data);
+    const quint32 *buckets = reinterpret_cast<const quint32 *>(data + header->bucketsOffset);
+    const quint32 mask = header->bucketCount - 1;
+
+    // the number of probes is limited in case of a damaged image
+    for(quint32 bucket = hash & mask, probes = 0;probes <= mask;bucket = (bucket + 1) & mask, probes++)
+    {
+        const quint32 offset = buckets[bucket];
+
+        if(!offset)
+            break;
+
+        // compare the hashes first to avoid touching the keys
+        if(offset + static_cast<qint64>(RECORD_HEADER_SIZE) > size
+                || *reinterpret_cast<const quint32 *>(data + offset) != hash)
+            continue;
+
+        const DictionaryIndex::Group group = groupAt(data, size, offset);
+
+        if(group.wordLength() == length && std::memcmp(group.key(), key, length) == 0)
+            return group;
+    }
+
+    return DictionaryIndex::Group();
+}
+
+/*
+ *  Words of the group without duplicates. The order is preserved, since
+ *  the search algorithm dives into the first anagram only
+ */
+std::vector<const std::string *> uniqueWords(const QVector<std::string> &words)
+{
+    std::vector<const std::string *> result;
+    result.reserve(words.size());
+
+    for(const std::string &word : words)
+        result.push_back(&word);
+
+    if(result.size() < 2)
+        return result;
+
+    // the stable sort keeps the first of the equal words first
+    std::stable_sort(result.begin(), result.end(), [](const std::string *a, const std::string *b) {
+        return *a < *b;
+    });
+
+    result.erase(std::unique(result.begin(), result.end(), [](const std::string *a, const std::string *b) {
+        return *a == *b;
+    }), result.end());
+
+    // the words are stored in a vector, so their addresses give the original order
+    std::sort(result.begin(), result.end(), std::less<const std::string *>());
+
+    return result;
+}
+
+}
+
+DictionaryIndex::DictionaryIndex()
+    : m_size(0)
+{}
+
+struct DictionaryIndex::TrieHolder
+{
+    QMutex mutex;
+    QScopedPointer<KeyTrie> trie;
+};
+
+DictionaryIndex::DictionaryIndex(const QSharedPointer<const char> &data, qint64 size)
+    : m_data(data)
+    , m_size(size)
+    , m_trie(new TrieHolder)
+{}
+
+DictionaryIndex DictionaryIndex::build(const Anagrams &anagrams, const QByteArray &fingerprint)
+{
+    TraceSpan span("index-build");
+
+    constexpr int MAX_FIELD = std::numeric_limits<quint16>::max();
+
+    // keep the load factor of the hash table at 0.5 or lower
+    quint32 bucketCount = 16;
+
+    while(bucketCount < static_cast<quint32>(anagrams.size()) * 2)
+        bucketCount <<= 1;
+
+    const quint64 bucketsOffset = sizeof(IndexHeader);
+    const quint64 recordsOffset = bucketsOffset + static_cast<quint64>(bucketCount) * sizeof(quint32);
+
+    quint64 imageSize = recordsOffset;
+    quint32 keyCount = 0;
+    quint32 wordCount = 0;
+    quint32 maxWordLength = 0;
+
+    // the groups to store, with the duplicates removed once for both passes
+    std::vector<std::pair<const std::string *, std::vector<const std::string *>>> groups;
+    groups.reserve(anagrams.size());
+
+    for(auto it = anagrams.constBegin();it != anagrams.constEnd();++it)
+    {
+        std::vector<const std::string *> words = uniqueWords(it.value());
+        const int length = static_cast<int>(it.key().length());
+        const int count = std::min(static_cast<int>(words.size()), MAX_FIELD);
+
+        if(length > MAX_FIELD || count == 0)
+            continue;
+
+        groups.emplace_back(&it.key(), std::move(words));
+        imageSize += recordSize(length, count);
+        keyCount++;
+        wordCount += count;
+        maxWordLength = std::max(maxWordLength, static_cast<quint32>(length));
+    }
+
+    // offsets are 32-bit
+    if(imageSize > std::numeric_limits<quint32>::max())
+    {
+        qWarning("The dictionary is too big to be indexed");
+        return DictionaryIndex();
+    }
+
+    char *image = new char[imageSize]();
+
+    IndexHeader *header = reinterpret_cast<IndexHeader *>(image);
+
+    std::memcpy(header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header->version = INDEX_VERSION;
+    header->keyCount = keyCount;
+    header->wordCount = wordCount;
+    header->bucketCount = bucketCount;
+    header->bucketsOffset = static_cast<quint32>(bucketsOffset);
+    header->recordsOffset = static_cast<quint32>(recordsOffset);
+    header->maxWordLength = maxWordLength;
+    header->imageSize = imageSize;
+    header->fingerprintSize = std::min(static_cast<quint32>(fingerprint.size()), static_cast<quint32>(sizeof(header->fingerprint)));
+    std::memcpy(header->fingerprint, fingerprint.constData(), header->fingerprintSize);
+
+    quint32 *buckets = reinterpret_cast<quint32 *>(image + bucketsOffset);
+    const quint32 mask = bucketCount - 1;
+    quint64 offset = recordsOffset;
+
+    for(const auto &group : groups)
+    {
+        const std::string &key = *group.first;
+        const std::vector<const std::string *> &words = group.second;
+        const int length = static_cast<int>(key.length());
+        const int count = std::min(static_cast<int>(words.size()), MAX_FIELD);
+
+        char *record = image + offset;
+        const quint32 hash = hashKey(key.c_str(), length);
+
+        *reinterpret_cast<quint32 *>(record) = hash;
+        *reinterpret_cast<quint16 *>(record + 4) = static_cast<quint16>(length);
+        *reinterpret_cast<quint16 *>(record + 6) = static_cast<quint16>(count);
+
+        char *dest = record + RECORD_HEADER_SIZE;
+        std::memcpy(dest, key.c_str(), length);
+
+        for(int i = 0;i < count;i++)
+        {
+            dest += length;
+            std::memcpy(dest, words[i]->c_str(), length);
+        }
+
+        // linear probing
+        quint32 bucket = hash & mask;
+
+        while(buckets[bucket])
+            bucket = (bucket + 1) & mask;
+
+        buckets[bucket] = static_cast<quint32>(offset);
+
+        offset += recordSize(length, count);
+    }
+
+    qDebug("Index has been built. Size: %llu bytes", static_cast<unsigned long long>(imageSize));
+
+    return DictionaryIndex(QSharedPointer<const char>(image, [](const char *data) { delete [] data; }),
+                           static_cast<qint64>(imageSize));
+}
+
+DictionaryIndex DictionaryIndex::mapFile(const QString &dictionaryPath)
+{
+    TraceSpan span("index-map");
+
+    const QFileInfo source(dictionaryPath);
+    QFile *file = new QFile(indexPath(dictionaryPath));
+
+    if(!file->exists() || !file->open(QFile::ReadOnly))
+    {
+        delete file;
+        return DictionaryIndex();
+    }
+
+    const qint64 size = file->size();
+    uchar *memory = size > 0 ? file->map(0, size) : nullptr;
+
+    if(!memory)
+    {
+        qWarning("Cannot map the index %s: %s", qPrintable(file->fileName()), qPrintable(file->errorString()));
+        delete file;
+        return DictionaryIndex();
+    }
+
+    const char *data = reinterpret_cast<const char *>(memory);
+
+    if(!validate(data, size)
+            || headerOf(data)->sourceSize != source.size()
+            || headerOf(data)->sourceModified != source.lastModified().toMSecsSinceEpoch())
+    {
+        qDebug("The index %s is damaged or outdated, ignoring it", qPrintable(file->fileName()));
+        file->unmap(memory);
+        delete file;
+        return DictionaryIndex();
+    }
+
+    qDebug("Index has been mapped. Size: %lld bytes", size);
+
+    return DictionaryIndex(QSharedPointer<const char>(data, [file, memory](const char *) {
+                               file->unmap(memory);
+                               delete file;
+                           }), size);
+}
+
+bool DictionaryIndex::saveFile(const QString &dictionaryPath) const
+{
+    TraceSpan span("index-save");
+
+    if(isNull())
+        return false;
+
+    const QFileInfo source(dictionaryPath);
+
+    IndexHeader header = *headerOf(m_data.data());
+    header.sourceSize = source.size();
+    header.sourceModified = source.lastModified().toMSecsSinceEpoch();
+
+    // write into a temporary file first, so other processes never map a half-written index
+    QSaveFile file(indexPath(dictionaryPath));
+
+    if(!file.open(QFile::WriteOnly)
+            || file.write(reinterpret_cast<const char *>(&header), sizeof(header)) != sizeof(header)
+            || file.write(m_data.data() + sizeof(header), m_size - sizeof(header)) != m_size - static_cast<qint64>(sizeof(header))
+            || !file.commit())
+    {
+        qWarning("Cannot save the index %s: %s", qPrintable(file.fileName()), qPrintable(file.errorString()));
+        return false;
+    }
+
+    return true;
+}
+
+QString DictionaryIndex::indexPath(const QString &dictionaryPath)
+{
+    return dictionaryPath + ".index";
+}
+
+int DictionaryIndex::size() const
+{
+    return isNull() ? 0 : static_cast<int>(headerOf(m_data.data())->keyCount);
+}
+
+int DictionaryIndex::wordCount() const
+{
+    return isNull() ? 0 : static_cast<int>(headerOf(m_data.data())->wordCount);
+}
+
+int DictionaryIndex::maxWordLength() const
+{
+    return isNull() ? 0 : static_cast<int>(headerOf(m_data.data())->maxWordLength);
+}
+
+QByteArray DictionaryIndex::fingerprint() const
+{
+    if(isNull())
+        return QByteArray();
+
+    const IndexHeader *header = headerOf(m_data.data());
+
+    return QByteArray(header->fingerprint, static_cast<int>(header->fingerprintSize));
+}
+
+DictionaryIndex::Group DictionaryIndex::group(const char *key, int length) const
+{
+    if(isNull())
+        return Group();
+
+    return findGroup(m_data.data(), m_size, key, length, hashKey(key, length));
+}
+
+void DictionaryIndex::groups(const char * const *keys, const int *lengths, int count, Group *result) const
+{
+    if(isNull())
+    {
+        std::fill(result, result + count, Group());
+        return;
+    }
+
+    const char *data = m_data.data();
+    const IndexHeader *header = headerOf(data);
+    const quint32 *buckets = reinterpret_cast<const quint32 *>(data + header->bucketsOffset);
+    const quint32 mask = header->bucketCount - 1;
+
+    for(int begin = 0;begin < count;begin += LOOKUP_BATCH_SIZE)
+    {
+        const int end = std::min(count, begin + LOOKUP_BATCH_SIZE);
+        quint32 hashes[LOOKUP_BATCH_SIZE];
+
+        // hash the keys and start loading their buckets
+        for(int i = begin;i < end;i++)
+        {
+            hashes[i - begin] = hashKey(keys[i], lengths[i]);
+            prefetch(buckets + (hashes[i - begin] & mask));
+        }
+
+        // start loading the records the buckets point to
+        for(int i = begin;i < end;i++)
+        {
+            const quint32 offset = buckets[hashes[i - begin] & mask];
+
+            if(offset && offset < m_size)
+                prefetch(data + offset);
+        }
+
+        // by now the most of the buckets and the records are in the cache
+        for(int i = begin;i < end;i++)
+            result[i] = findGroup(data, m_size, keys[i], lengths[i], hashes[i - begin]);
+    }
+}
+
+void DictionaryIndex::forEachGroup(const std::function<void(const Group &)> &callback) const
+{
+    if(isNull())
+        return;
+
+    const char *data = m_data.data();
+    const IndexHeader *header = headerOf(data);
+    const quint32 *buckets = reinterpret_cast<const quint32 *>(data + header->bucketsOffset);
+
+    for(quint32 bucket = 0;bucket < header->bucketCount;bucket++)
+    {
+        if(!buckets[bucket])
+            continue;
+
+        const Group group = groupAt(data, m_size, buckets[bucket]);
+
+        if(!group.isEmpty())
+            callback(group);
+    }
+}
+
+const KeyTrie &DictionaryIndex::trie() const
+{
+    static const KeyTrie empty;
+
+    if(!m_trie)
+        return empty;
+
+    QMutexLocker locker(&m_trie->mutex);
+
+    if(!m_trie->trie)
+        m_trie->trie.reset(new KeyTrie(*this));
+
+    return *m_trie->trie;
+}
+
+MemoryUsage DictionaryIndex::memoryUsage() const
+{
+    MemoryUsage result;
+
+    if(isNull())
+        return result;
+
+    const IndexHeader *header = headerOf(m_data.data());
+    qint64 keys = 0;
+    qint64 words = 0;
+
+    forEachGroup([&keys, &words](const Group &group) {
+        keys += group.wordLength();
+        words += static_cast<qint64>(group.wordLength()) * group.size();
+    });
+
+    const qint64 buckets = static_cast<qint64>(header->bucketCount) * sizeof(quint32);
+    const qint64 recordHeaders = static_cast<qint64>(header->keyCount) * RECORD_HEADER_SIZE;
+
+    result.add("header", sizeof(IndexHeader));
+    result.add("buckets", buckets, header->bucketCount);
+    result.add("group headers", recordHeaders, header->keyCount);
+    result.add("keys", keys, header->keyCount);
+    result.add("words", words, header->wordCount);
+    result.add("padding", m_size - static_cast<qint64>(sizeof(IndexHeader)) - buckets - recordHeaders - keys - words);
+
+    // the trie is not a part of the image, and exists only after the first structured query
+    if(m_trie)
+    {
+        QMutexLocker locker(&m_trie->mutex);
+
+        if(m_trie->trie)
+            result.add(QString(), m_trie->trie->memoryUsage());
+    }
+
+    return result;
+}
+
+bool DictionaryIndex::validate(const char *data, qint64 size)
+{
+    if(size < static_cast<qint64>(sizeof(IndexHeader)))
+        return false;
+
+    const IndexHeader *header = headerOf(data);
+
+    return std::memcmp(header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0
+            && header->version == INDEX_VERSION
+            && header->imageSize == static_cast<quint64>(size)
+            && header->bucketCount > 0
+            && (header->bucketCount & (header->bucketCount - 1)) == 0
+            && header->keyCount < header->bucketCount
+            && header->bucketsOffset == sizeof(IndexHeader)
+            && header->recordsOffset == header->bucketsOffset + static_cast<quint64>(header->bucketCount) * sizeof(quint32)
+            && header->recordsOffset <= static_cast<quint64>(size)
+            && header->fingerprintSize <= sizeof(header->fingerprint);
+}
@@ -0,0 +1,287 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef DICTIONARYINDEX_H
+#define DICTIONARYINDEX_H
+
+#include "anagrams.h"
+#include "memoryusage.h"
+
+#include <functional>
+#include <string>
+
+class KeyTrie;
+
+/*
+ *  Immutable position-independent image of the dictionary hash. The image is a single
+ *  block of memory with no pointers inside (only offsets), so it can be saved into a file
+ *  and mapped back by any number of processes. The mapped pages are shared through the
+ *  page cache, so the memory cost doesn't depend on the number of processes using the index,
+ *  and attaching to an existing index takes microseconds instead of reparsing the dictionary.
+ *
+ *  Image layout:
+ *
+ *  header:  magic, version, sizes, dictionary fingerprint and file info
+ *  buckets: open addressing hash table of record offsets (0 = empty bucket)
+ *  records: hash, key length, number of words, key, words
+ *
+ *  All the words of a group have the same length as the key, so they are stored
+ *  one by one without separators:
+ *
+ *  alow -> [ owla, lowa ] is stored as "alowowlalowa"
+ *
+ *  DictionaryIndex is implicitly shared, copying it is cheap
+ */
+class DictionaryIndex
+{
+public:
+    /*
+     *  A group of anagrams stored in the index. Words are not null-terminated
+     */
+    class Group
+    {
+    public:
+        inline
+        Group();
+
+        inline
+        Group(const char *data, int length, int count);
+
+        inline
+        bool isEmpty() const;
+
+        /*
+         *  Number of words in the group
+         */
+        inline
+        int size() const;
+
+        /*
+         *  Length of the key and every word in the group
+         */
+        inline
+        int wordLength() const;
+
+        /*
+         *  Sorted key of the group
+         */
+        inline
+        const char *key() const;
+
+        inline
+        const char *word(int i) const;
+
+        inline
+        std::string keyString() const;
+
+        inline
+        std::string wordString(int i) const;
+
+    private:
+        const char *m_data;
+        int m_length;
+        int m_count;
+    };
+
+    DictionaryIndex();
+
+    /*
+     *  Build the image from the parsed dictionary. Duplicate words in the same
+     *  group are stored only once
+     */
+    static
+    DictionaryIndex build(const Anagrams &anagrams, const QByteArray &fingerprint);
+
+    /*
+     *  Map the saved index of the dictionary. Returns a null index if the file doesn't
+     *  exist, is damaged, or has been built from another version of the dictionary
+     */
+    static
+    DictionaryIndex mapFile(const QString &dictionaryPath);
+
+    /*
+     *  Save the index next to the dictionary. The file info of the dictionary
+     *  is saved as well to detect outdated indexes
+     */
+    bool saveFile(const QString &dictionaryPath) const;
+
+    /*
+     *  Path to the saved index of the specified dictionary
+     */
+    static
+    QString indexPath(const QString &dictionaryPath);
+
+    inline
+    bool isNull() const;
+
+    /*
+     *  Number of groups (keys)
+     */
+    int size() const;
+
+    /*
+     *  Number of words in all the groups
+     */
+    int wordCount() const;
+
+    /*
+     *  Length of the longest word. No chain can go beyond it
+     */
+    int maxWordLength() const;
+
+    /*
+     *  Hash of the dictionary contents
+     */
+    QByteArray fingerprint() const;
+
+    /*
+     *  Find the group by its sorted key. Returns an empty group if not found
+     */
+    Group group(const char *key, int length) const;
+
+    inline
+    Group group(const std::string &key) const;
+
+    /*
+     *  Find the groups of 'count' keys at once. The lookups are pipelined: the buckets
+     *  of a batch of keys are prefetched first, then the records they point to, and only
+     *  then the keys are compared, so the cache misses of different keys overlap
+     */
+    void groups(const char * const *keys, const int *lengths, int count, Group *result) const;
+
+    /*
+     *  Iterate over all the groups in the order they are stored in the image
+     */
+    void forEachGroup(const std::function<void(const Group &)> &callback) const;
+
+    /*
+     *  Trie of the keys for the structured queries. Built on the first call and shared
+     *  by all the copies of the index. Safe to call from any thread
+     */
+    const KeyTrie &trie() const;
+
+    /*
+     *  Size of the image broken down by the header, the buckets, the record headers,
+     *  the keys, the words and the alignment padding, plus the key trie if it has been built
+     */
+    MemoryUsage memoryUsage() const;
+
+    /*
+     *  Raw image
+     */
+    inline
+    const char *data() const;
+
+    inline
+    qint64 dataSize() const;
+
+private:
+    DictionaryIndex(const QSharedPointer<const char> &data, qint64 size);
+
+    /*
+     *  Check the header and the buckets of the image
+     */
+    static
+    bool validate(const char *data, qint64 size);
+
+private:
+    struct TrieHolder;
+
+private:
+    // the owner of the image: a heap block or a mapped file
+    QSharedPointer<const char> m_data;
+    qint64 m_size;
+    // built lazily
+    QSharedPointer<TrieHolder> m_trie;
+};
+
+DictionaryIndex::Group::Group()
+    : m_data(nullptr)
+    , m_length(0)
+    , m_count(0)
+{}
+
+DictionaryIndex::Group::Group(const char *data, int length, int count)
+    : m_data(data)
+    , m_length(length)
+    , m_count(count)
+{}
+
+bool DictionaryIndex::Group::isEmpty() const
+{
+    return m_count == 0;
+}
+
+int DictionaryIndex::Group::size() const
+{
+    return m_count;
+}
+
+int DictionaryIndex::Group::wordLength() const
+{
+    return m_length;
+}
+
+const char *DictionaryIndex::Group::key() const
+{
+    return m_data;
+}
+
+const char *DictionaryIndex::Group::word(int i) const
+{
+    return m_data + m_length * (i + 1);
+}
+
+std::string DictionaryIndex::Group::keyString() const
+{
+    return std::string(key(), m_length);
+}
+
+std::string DictionaryIndex::Group::wordString(int i) const
+{
+    return std::string(word(i), m_length);
+}
+
+bool DictionaryIndex::isNull() const
+{
+    return m_data.isNull();
+}
+
+DictionaryIndex::Group DictionaryIndex::group(const std::string &key) const
+{
+    return group(key.c_str(), static_cast<int>(key.length()));
+}
+
+const char *DictionaryIndex::data() const
+{
+    return m_data.data();
+}
+
+qint64 DictionaryIndex::dataSize() const
+{
+    return m_size;
+}
+
+#endif // DICTIONARYINDEX_H
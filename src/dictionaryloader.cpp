@@ -23,10 +23,7 @@
     SOFTWARE.
 */
 
-#include <algorithm>
-
 #include "dictionaryloader.h"
-#include "settings.h"
 #include "utils.h"
 #include "ui_dictionaryloader.h"
 
@@ -72,33 +69,20 @@ void DictionaryLoader::nextIteration()
 void DictionaryLoader::slotNextIteration()
 {
     constexpr int MAX_LINES = 1000;
-    int i = 0;
 
     updateProgress();
 
-    while(!m_dictionaryFile.atEnd() && i++ < MAX_LINES)
-    {
-        QByteArray line = m_dictionaryFile.readLine().trimmed().toLower();
-
-        // ignore invalid/not supported words
-        if(!Settings::wordValidator().exactMatch(line))
-            continue;
-
-        // sort the word and add it to the dictionary hash as a
-        // 'sorted' -> 'original words' mapping. Like that:
-        // low -> [owl, low, wol...]
-        std::string sortedLine = line.constData();
-        std::sort(sortedLine.begin(), sortedLine.end());
-        m_anagrams[sortedLine].append(std::string(line.constData()));
-    }
+    m_parser.parse(&m_dictionaryFile, MAX_LINES);
 
     if(!m_dictionaryFile.atEnd())
         nextIteration();
     else
     {
-        qDebug("Dictionary has been loaded. Size: %d", m_anagrams.size());
+        const Anagrams anagrams = m_parser.anagrams();
+
+        qDebug("Dictionary has been loaded. Size: %d", anagrams.size());
 
-        if(m_anagrams.isEmpty())
+        if(anagrams.isEmpty())
         {
             Utils::error(tr("The dictionary is empty"), this);
             reject();
@@ -26,7 +26,7 @@
 #ifndef DICTIONARYLOADER_H
 #define DICTIONARYLOADER_H
 
-#include "anagrams.h"
+#include "dictionaryparser.h"
 
 #include <QtWidgets>
 
@@ -70,6 +70,13 @@ public:
     inline
     Anagrams anagrams() const;
 
+    /*
+     *  Hash of the dictionary contents. Identifies the dictionary
+     *  in the result store
+     */
+    inline
+    QByteArray fingerprint() const;
+
 private:
     void updateProgress();
     // load a next bunch of lines
@@ -80,7 +87,7 @@ private slots:
 
 private:
     Ui::DictionaryLoader *ui;
-    Anagrams m_anagrams;
+    DictionaryParser m_parser;
     QFile m_dictionaryFile;
     bool m_error;
     QString m_errorString;
@@ -98,7 +105,12 @@ QString DictionaryLoader::errorString() const
 
 Anagrams DictionaryLoader::anagrams() const
 {
-    return m_anagrams;
+    return m_parser.anagrams();
+}
+
+QByteArray DictionaryLoader::fingerprint() const
+{
+    return m_parser.fingerprint();
 }
 
 #endif // DICTIONARYLOADER_H
@@ -0,0 +1,85 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "dictionaryparser.h"
+#include "settings.h"
+#include "tracer.h"
+
+DictionaryParser::DictionaryParser()
+    : m_fingerprint(QCryptographicHash::Sha1)
+    , m_wordValidator(Settings::wordValidator())
+{}
+
+bool DictionaryParser::parse(QIODevice *device, int maxLines)
+{
+    int i = 0;
+
+    if(!Tracer::isEnabled())
+    {
+        while(!device->atEnd() && (maxLines < 0 || i++ < maxLines))
+            addLine(device->readLine());
+
+        return device->atEnd();
+    }
+
+    // read the lines first to trace the I/O and the parsing separately
+    QList<QByteArray> lines;
+
+    {
+        TraceSpan span("file-read");
+
+        while(!device->atEnd() && (maxLines < 0 || i++ < maxLines))
+            lines.append(device->readLine());
+    }
+
+    {
+        TraceSpan span("parse");
+
+        for(const QByteArray &line : lines)
+            addLine(line);
+    }
+
+    return device->atEnd();
+}
+
+void DictionaryParser::addLine(const QByteArray &rawLine)
+{
+    m_fingerprint.addData(rawLine);
+
+    const QByteArray line = rawLine.trimmed().toLower();
+
+    // ignore invalid/not supported words
+    if(!m_wordValidator.exactMatch(line))
+        return;
+
+    // sort the word and add it to the dictionary hash as a
+    // 'sorted' -> 'original words' mapping. Like that:
+    // low -> [owl, low, wol...]
+    std::string sortedLine = line.constData();
+    std::sort(sortedLine.begin(), sortedLine.end());
+    m_anagrams[sortedLine].append(std::string(line.constData()));
+}
@@ -0,0 +1,81 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef DICTIONARYPARSER_H
+#define DICTIONARYPARSER_H
+
+#include "anagrams.h"
+
+/*
+ *  Parser of dictionaries. Reads a dictionary line by line and constructs the hash
+ *  'sorted' -> 'original words'. Doesn't depend on the UI, so it is used by DictionaryLoader
+ *  and by the command line tools
+ */
+class DictionaryParser
+{
+public:
+    DictionaryParser();
+
+    /*
+     *  Parse up to 'maxLines' lines of the device, or the whole device if 'maxLines' is negative.
+     *  Returns true when the device is at its end
+     */
+    bool parse(QIODevice *device, int maxLines = -1);
+
+    /*
+     *  Parse a single line
+     */
+    void addLine(const QByteArray &line);
+
+    /*
+     *  Actual parse result
+     */
+    inline
+    Anagrams anagrams() const;
+
+    /*
+     *  Hash of the dictionary contents. Identifies the dictionary
+     *  in the result store
+     */
+    inline
+    QByteArray fingerprint() const;
+
+private:
+    Anagrams m_anagrams;
+    QCryptographicHash m_fingerprint;
+    QRegExp m_wordValidator;
+};
+
+Anagrams DictionaryParser::anagrams() const
+{
+    return m_anagrams;
+}
+
+QByteArray DictionaryParser::fingerprint() const
+{
+    return m_fingerprint.result();
+}
+
+#endif // DICTIONARYPARSER_H
@@ -0,0 +1,195 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "dictionarypreloader.h"
+#include "dictionaryparser.h"
+#include "tracer.h"
+
+namespace
+{
+
+/*
+ *  Loading executed by one of the global pool threads
+ */
+class PreloadTask : public QRunnable
+{
+public:
+    PreloadTask(const QString &dictionaryPath, bool useIndexFile)
+        : m_dictionaryPath(dictionaryPath)
+        , m_useIndexFile(useIndexFile)
+    {
+        m_interface.reportStarted();
+    }
+
+    QFuture<DictionaryIndex> future()
+    {
+        return m_interface.future();
+    }
+
+    virtual void run() override
+    {
+        DictionaryIndex index;
+
+        if(!m_interface.isCanceled())
+            index = load();
+
+        m_interface.reportResult(index);
+        m_interface.reportFinished();
+    }
+
+private:
+    DictionaryIndex load()
+    {
+        constexpr int MAX_LINES = 1000;
+
+        TraceSpan span("preload-dictionary", [this] { return m_dictionaryPath; });
+
+        if(m_useIndexFile)
+        {
+            const DictionaryIndex mapped = DictionaryIndex::mapFile(m_dictionaryPath);
+
+            if(!mapped.isNull())
+                return mapped;
+        }
+
+        QFile file(m_dictionaryPath);
+
+        // the errors are reported when the dictionary is loaded as usual
+        if(!file.open(QFile::ReadOnly))
+        {
+            qWarning("Cannot preload the dictionary: %s", qPrintable(file.errorString()));
+            return DictionaryIndex();
+        }
+
+        DictionaryParser parser;
+
+        // parse by chunks to stop quickly when canceled
+        while(!parser.parse(&file, MAX_LINES))
+        {
+            if(m_interface.isCanceled())
+                return DictionaryIndex();
+        }
+
+        const Anagrams anagrams = parser.anagrams();
+
+        if(anagrams.isEmpty())
+            return DictionaryIndex();
+
+        DictionaryIndex index = DictionaryIndex::build(anagrams, parser.fingerprint());
+
+        // save the index and map it back, so the memory is shared with other processes
+        if(m_useIndexFile && !index.isNull() && index.saveFile(m_dictionaryPath))
+        {
+            const DictionaryIndex mapped = DictionaryIndex::mapFile(m_dictionaryPath);
+
+            if(!mapped.isNull())
+                index = mapped;
+        }
+
+        qDebug("Dictionary has been preloaded. Size: %d", index.size());
+
+        return index;
+    }
+
+private:
+    QString m_dictionaryPath;
+    bool m_useIndexFile;
+    QFutureInterface<DictionaryIndex> m_interface;
+};
+
+}
+
+DictionaryPreloader::DictionaryPreloader()
+    : m_useIndexFile(false)
+{}
+
+DictionaryPreloader::~DictionaryPreloader()
+{
+    cancel();
+}
+
+void DictionaryPreloader::start(const QString &dictionaryPath, bool useIndexFile)
+{
+    cancel();
+
+    const QFileInfo info(dictionaryPath);
+
+    if(dictionaryPath.isEmpty() || !info.isFile())
+        return;
+
+    qDebug("Preloading the dictionary %s", qPrintable(dictionaryPath));
+
+    m_dictionaryPath = dictionaryPath;
+    m_useIndexFile = useIndexFile;
+    m_lastModified = info.lastModified();
+
+    PreloadTask *task = new PreloadTask(dictionaryPath, useIndexFile);
+    m_future = task->future();
+
+    // the global pool takes the ownership of the task. The search pool is not used,
+    // so the searches are not blocked by a preloading
+    QThreadPool::globalInstance()->start(task);
+}
+
+void DictionaryPreloader::cancel()
+{
+    m_future.cancel();
+    m_future = QFuture<DictionaryIndex>();
+    m_dictionaryPath.clear();
+}
+
+DictionaryIndex DictionaryPreloader::take(const QString &dictionaryPath, bool useIndexFile)
+{
+    // the preloaded dictionary is not the requested one, or it has been changed since then
+    if(m_dictionaryPath.isEmpty()
+            || m_dictionaryPath != dictionaryPath
+            || m_useIndexFile != useIndexFile
+            || QFileInfo(dictionaryPath).lastModified() != m_lastModified)
+    {
+        cancel();
+        return DictionaryIndex();
+    }
+
+    if(!m_future.isFinished())
+    {
+        qDebug("Waiting for the dictionary to be preloaded");
+
+        QFutureWatcher<DictionaryIndex> watcher;
+        QEventLoop loop;
+
+        QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+        watcher.setFuture(m_future);
+
+        if(!m_future.isFinished())
+            loop.exec();
+    }
+
+    const DictionaryIndex index = m_future.isCanceled() ? DictionaryIndex() : m_future.result();
+
+    m_future = QFuture<DictionaryIndex>();
+    m_dictionaryPath.clear();
+
+    return index;
+}
@@ -0,0 +1,69 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef DICTIONARYPRELOADER_H
+#define DICTIONARYPRELOADER_H
+
+#include <QtCore>
+
+#include "dictionaryindex.h"
+
+/*
+ *  Loads a dictionary in the background, so it's ready when the user needs it. The app
+ *  preloads the last used dictionary while the options dialog is open. If the index file
+ *  is enabled, the index is mapped, or built and saved if it doesn't exist yet
+ */
+class DictionaryPreloader
+{
+public:
+    DictionaryPreloader();
+    ~DictionaryPreloader();
+
+    /*
+     *  Start loading the dictionary. The previous preloading is canceled
+     */
+    void start(const QString &dictionaryPath, bool useIndexFile);
+
+    /*
+     *  Stop preloading and forget the result
+     */
+    void cancel();
+
+    /*
+     *  Index of the dictionary if it has been preloaded with the same parameters. Waits
+     *  for the preloading to finish, and processes the events meanwhile. Returns a null
+     *  index if the dictionary has not been preloaded or if the preloading has failed,
+     *  then the dictionary must be loaded as usual
+     */
+    DictionaryIndex take(const QString &dictionaryPath, bool useIndexFile);
+
+private:
+    QString m_dictionaryPath;
+    bool m_useIndexFile;
+    QDateTime m_lastModified;
+    QFuture<DictionaryIndex> m_future;
+};
+
+#endif // DICTIONARYPRELOADER_H
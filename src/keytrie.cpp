@@ -0,0 +1,231 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "keytrie.h"
+#include "sortedkey.h"
+#include "tracer.h"
+
+/*
+ *  State of forEachSuperset(). The letters of the key are matched greedily: a child
+ *  with the next letter of the key always consumes it, so every node is visited once
+ */
+class KeyTrie::SupersetWalk
+{
+public:
+    SupersetWalk(const KeyTrie &trie, const char *keyEnd, const char *letters, const Callback &callback)
+        : m_trie(trie)
+        , m_keyEnd(keyEnd)
+        , m_callback(callback)
+    {
+        std::memset(m_allowed, 0, sizeof(m_allowed));
+
+        for(const char *letter = letters ? letters : alphabet;*letter;letter++)
+            m_allowed[static_cast<unsigned char>(*letter)] = true;
+    }
+
+    void visit(qint32 node, const char *key, int extra)
+    {
+        // all the letters are placed, the longer keys have more extra letters
+        if(key == m_keyEnd && !extra)
+        {
+            if(m_trie.m_nodes[node].group >= 0)
+                m_callback(m_trie.m_groups[m_trie.m_nodes[node].group]);
+
+            return;
+        }
+
+        for(qint32 child = m_trie.m_nodes[node].firstChild;child >= 0;child = m_trie.m_nodes[child].nextSibling)
+        {
+            const char letter = m_trie.m_nodes[child].letter;
+
+            if(key != m_keyEnd)
+            {
+                if(letter == *key)
+                {
+                    visit(child, key + 1, extra);
+                    continue;
+                }
+
+                // the children are sorted, so the next letter of the key cannot be matched anymore
+                if(letter > *key)
+                    break;
+            }
+
+            if(extra && m_allowed[static_cast<unsigned char>(letter)])
+                visit(child, key, extra - 1);
+        }
+    }
+
+private:
+    const KeyTrie &m_trie;
+    const char *m_keyEnd;
+    const Callback &m_callback;
+    bool m_allowed[256];
+};
+
+/*
+ *  State of forEachSubset(). A child is walked while its letter is still in the rack,
+ *  or a blank is left to stand for it
+ */
+class KeyTrie::SubsetWalk
+{
+public:
+    SubsetWalk(const KeyTrie &trie, const char *rack, int length, int minLength, const Callback &callback)
+        : m_trie(trie)
+        , m_minLength(minLength)
+        , m_callback(callback)
+        , m_lastLetter(0)
+    {
+        std::memset(m_counts, 0, sizeof(m_counts));
+
+        for(int i = 0;i < length;i++)
+        {
+            const unsigned char letter = static_cast<unsigned char>(rack[i]);
+
+            m_counts[letter]++;
+            m_lastLetter = std::max(m_lastLetter, letter);
+        }
+    }
+
+    void visit(qint32 node, int depth, int blanks)
+    {
+        if(depth >= m_minLength && m_trie.m_nodes[node].group >= 0)
+            m_callback(m_trie.m_groups[m_trie.m_nodes[node].group]);
+
+        for(qint32 child = m_trie.m_nodes[node].firstChild;child >= 0;child = m_trie.m_nodes[child].nextSibling)
+        {
+            const unsigned char letter = static_cast<unsigned char>(m_trie.m_nodes[child].letter);
+
+            // the children are sorted, and nothing in the rack can match the next ones
+            if(!blanks && letter > m_lastLetter)
+                break;
+
+            if(m_counts[letter])
+            {
+                m_counts[letter]--;
+                visit(child, depth + 1, blanks);
+                m_counts[letter]++;
+            }
+            else if(blanks)
+                visit(child, depth + 1, blanks - 1);
+        }
+    }
+
+private:
+    const KeyTrie &m_trie;
+    const int m_minLength;
+    const Callback &m_callback;
+    int m_counts[256];
+    unsigned char m_lastLetter;
+};
+
+KeyTrie::KeyTrie()
+{
+    m_nodes.push_back({ -1, -1, -1, 0 });
+}
+
+KeyTrie::KeyTrie(const DictionaryIndex &index)
+    : KeyTrie()
+{
+    TraceSpan span("trie-build");
+
+    m_groups.reserve(index.size());
+
+    index.forEachGroup([this](const DictionaryIndex::Group &group) {
+        m_groups.push_back(group);
+    });
+
+    std::sort(m_groups.begin(), m_groups.end(), [](const DictionaryIndex::Group &a, const DictionaryIndex::Group &b) {
+        const int result = std::memcmp(a.key(), b.key(), std::min(a.wordLength(), b.wordLength()));
+        return result < 0 || (result == 0 && a.wordLength() < b.wordLength());
+    });
+
+    // the nodes of the previous key. Since the keys are sorted, the new nodes of the next
+    // key are always appended after the last children of the shared prefix
+    std::vector<qint32> path(1, 0);
+    const char *previous = nullptr;
+    int previousLength = 0;
+
+    for(std::size_t i = 0;i < m_groups.size();i++)
+    {
+        const char *key = m_groups[i].key();
+        const int length = m_groups[i].wordLength();
+        int common = 0;
+
+        while(common < length && common < previousLength && key[common] == previous[common])
+            common++;
+
+        for(int depth = common;depth < length;depth++)
+        {
+            const qint32 node = static_cast<qint32>(m_nodes.size());
+
+            m_nodes.push_back({ -1, -1, -1, key[depth] });
+
+            if(depth == common && static_cast<int>(path.size()) > depth + 1)
+                m_nodes[path[depth + 1]].nextSibling = node;
+            else
+                m_nodes[path[depth]].firstChild = node;
+
+            path.resize(depth + 1);
+            path.push_back(node);
+        }
+
+        path.resize(length + 1);
+        m_nodes[path.back()].group = static_cast<qint32>(i);
+
+        previous = key;
+        previousLength = length;
+    }
+
+    qDebug("Key trie has been built. Nodes: %d", size());
+}
+
+void KeyTrie::forEachSuperset(const char *key, int length, int extra, const char *letters, const Callback &callback) const
+{
+    if(extra < 0)
+        return;
+
+    SupersetWalk walk(*this, key + length, letters, callback);
+    walk.visit(0, key, extra);
+}
+
+void KeyTrie::forEachSubset(const char *rack, int length, int blanks, int minLength, const Callback &callback) const
+{
+    SubsetWalk walk(*this, rack, length, minLength, callback);
+    walk.visit(0, 0, std::max(0, blanks));
+}
+
+MemoryUsage KeyTrie::memoryUsage() const
+{
+    MemoryUsage result;
+
+    result.add("trie nodes", static_cast<qint64>(m_nodes.capacity() * sizeof(Node)), size());
+    result.add("trie groups", static_cast<qint64>(m_groups.capacity() * sizeof(DictionaryIndex::Group)), m_groups.size());
+
+    return result;
+}
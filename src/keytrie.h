@@ -0,0 +1,101 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef KEYTRIE_H
+#define KEYTRIE_H
+
+#include <functional>
+#include <vector>
+
+#include "dictionaryindex.h"
+
+/*
+ *  Trie of the sorted keys of the index. Since the keys are sorted, a path from the root
+ *  spells a multiset of letters in the alphabetical order, and the children of a node are
+ *  the letters not less than the letter of the node. That allows to answer the structured
+ *  queries in a single walk instead of probing every combination of letters:
+ *
+ *  - all the keys containing the letters of a key plus exactly k more letters ("ow" + 1
+ *    gives "low", "owe", "tow"...)
+ *  - all the keys made of the letters of a rack ("lowe" gives "lo", "low", "owe", "lowe"...)
+ *
+ *  The trie points into the index, so the index must outlive it. Use DictionaryIndex::trie()
+ *  to get the trie shared by all the copies of the index
+ */
+class KeyTrie
+{
+public:
+    using Callback = std::function<void(const DictionaryIndex::Group &)>;
+
+    KeyTrie();
+    explicit KeyTrie(const DictionaryIndex &index);
+
+    /*
+     *  Call 'callback' for every key containing all the letters of the sorted key and
+     *  exactly 'extra' more letters. The extra letters are taken from 'letters' only,
+     *  or from the whole alphabet if it's null. The keys are reported in the sorted order
+     */
+    void forEachSuperset(const char *key, int length, int extra, const char *letters, const Callback &callback) const;
+
+    /*
+     *  Call 'callback' for every key of 'minLength' letters or longer made of the letters
+     *  of the rack. Every letter is used as many times as it's in the rack, and every blank
+     *  stands for any letter. The rack doesn't have to be sorted. The keys are reported
+     *  in the sorted order
+     */
+    void forEachSubset(const char *rack, int length, int blanks, int minLength, const Callback &callback) const;
+
+    /*
+     *  Number of nodes
+     */
+    inline
+    int size() const;
+
+    MemoryUsage memoryUsage() const;
+
+private:
+    struct Node
+    {
+        qint32 firstChild;
+        qint32 nextSibling;
+        // the group with the key spelled by the path to the node, or -1
+        qint32 group;
+        char letter;
+    };
+
+    class SupersetWalk;
+    class SubsetWalk;
+
+private:
+    std::vector<Node> m_nodes;
+    std::vector<DictionaryIndex::Group> m_groups;
+};
+
+int KeyTrie::size() const
+{
+    return static_cast<int>(m_nodes.size());
+}
+
+#endif // KEYTRIE_H
@@ -0,0 +1,303 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "laddersearch.h"
+#include "sortedkey.h"
+#include "tracer.h"
+
+LadderSearch::LadderSearch(const DictionaryIndex &index)
+    : m_index(index)
+    , m_allowRemovals(false)
+{}
+
+void LadderSearch::setAllowRemovals(bool allow)
+{
+    m_allowRemovals = allow;
+}
+
+LongestPaths LadderSearch::find(const QString &from, const QString &to, int maxChains, SearchStatistics *statistics)
+{
+    TraceSpan span("ladder-search", [&from, &to] { return from + " -> " + to; });
+
+    m_from = from.toLower().toStdString();
+    m_to = to.toLower().toStdString();
+    m_fromKey = m_from;
+    m_toKey = m_to;
+
+    std::sort(m_fromKey.begin(), m_fromKey.end());
+    std::sort(m_toKey.begin(), m_toKey.end());
+
+    LongestPaths result;
+    QVector<DepthStatistics> depths;
+    Side forward;
+    Side backward;
+
+    // with the additions only, the last word must contain the first one
+    const bool reachable = !m_fromKey.empty() && !m_toKey.empty()
+                            && (m_allowRemovals || (m_toKey.length() > m_fromKey.length()
+                                                    && std::includes(m_toKey.begin(), m_toKey.end(), m_fromKey.begin(), m_fromKey.end())));
+
+    if(m_fromKey == m_toKey)
+    {
+        LongestPath chain;
+        chain.push(m_from);
+        result.append(chain);
+    }
+    else if(reachable && maxChains != 0)
+    {
+        for(Side *side : { &forward, &backward })
+        {
+            const std::string &key = side == &forward ? m_fromKey : m_toKey;
+
+            side->nodes.push_back({ key.c_str(), static_cast<int>(key.length()), std::vector<int>() });
+            side->lookup.emplace(key.c_str(), 0);
+            side->levelBegin = 0;
+        }
+
+        while(true)
+        {
+            const std::size_t forwardFrontier = forward.nodes.size() - forward.levelBegin;
+            const std::size_t backwardFrontier = backward.nodes.size() - backward.levelBegin;
+
+            // one of the sides cannot go further, the sides will never meet
+            if(!forwardFrontier || !backwardFrontier)
+                break;
+
+            DepthStatistics counters;
+            const bool expandForward = forwardFrontier <= backwardFrontier;
+            Side *side = expandForward ? &forward : &backward;
+            const Side &other = expandForward ? backward : forward;
+
+            const std::vector<int> meetings = expand(side, other, expandForward, &counters);
+
+            depths.append(counters);
+
+            if(meetings.empty())
+                continue;
+
+            // all the meetings are at the same distance from both words
+            for(const int meeting : meetings)
+            {
+                const int otherNode = other.lookup.at(side->nodes[meeting].key);
+
+                if(expandForward)
+                    collectChains(forward, meeting, backward, otherNode, maxChains, &result);
+                else
+                    collectChains(forward, otherNode, backward, meeting, maxChains, &result);
+            }
+
+            break;
+        }
+    }
+
+    if(statistics)
+    {
+        *statistics = SearchStatistics();
+        statistics->depths = depths;
+        statistics->memory.add("forward keys", static_cast<qint64>(forward.nodes.capacity() * sizeof(Node)),
+                               static_cast<qint64>(forward.nodes.size()));
+        statistics->memory.add("backward keys", static_cast<qint64>(backward.nodes.capacity() * sizeof(Node)),
+                               static_cast<qint64>(backward.nodes.size()));
+        statistics->memory.add("results: ", MemoryUsage::ofPaths(result));
+    }
+
+    return result;
+}
+
+std::vector<int> LadderSearch::expand(Side *side, const Side &other, bool forward, DepthStatistics *counters)
+{
+    std::vector<int> meetings;
+    std::string key;
+
+    const std::size_t levelEnd = side->nodes.size();
+    // the backward side walks the steps in reverse, so its additions are the removals
+    const bool addLetters = forward || m_allowRemovals;
+    const bool removeLetters = !forward || m_allowRemovals;
+
+    auto reach = [&](std::size_t parent, const char *candidate, int length) {
+        counters->probes++;
+
+        const char *found = resolve(candidate, length);
+
+        if(!found)
+            return;
+
+        counters->hits++;
+
+        const auto it = side->lookup.find(found);
+
+        if(it == side->lookup.end())
+        {
+            const int node = static_cast<int>(side->nodes.size());
+
+            side->nodes.push_back({ found, length, std::vector<int>(1, static_cast<int>(parent)) });
+            side->lookup.emplace(found, node);
+
+            if(other.lookup.count(found))
+                meetings.push_back(node);
+        }
+        // another route of the same length, keep it for the chains
+        else if(static_cast<std::size_t>(it->second) >= levelEnd)
+            side->nodes[it->second].parents.push_back(static_cast<int>(parent));
+        else
+            counters->skipped++;
+    };
+
+    for(std::size_t i = side->levelBegin;i < levelEnd;i++)
+    {
+        // the nodes grow while expanding, so don't keep references to them
+        const char *current = side->nodes[i].key;
+        const int length = side->nodes[i].length;
+
+        counters->nodes++;
+
+        if(addLetters)
+        {
+            key.resize(length + 1);
+
+            for(const char *letter = alphabet;*letter;letter++)
+            {
+                insertIntoSortedKey(current, length, *letter, &key[0]);
+
+                // with the additions only, every word is contained in the last word
+                if(!m_allowRemovals && !std::includes(m_toKey.begin(), m_toKey.end(), key.begin(), key.end()))
+                    continue;
+
+                reach(i, key.data(), length + 1);
+            }
+        }
+
+        if(removeLetters && length > 1)
+        {
+            key.resize(length - 1);
+
+            for(int position = 0;position < length;position++)
+            {
+                // removing any of the repeated letters gives the same key
+                if(position > 0 && current[position] == current[position - 1])
+                    continue;
+
+                removeFromSortedKey(current, length, position, &key[0]);
+
+                // with the additions only, every word contains the first word
+                if(!m_allowRemovals && !std::includes(key.begin(), key.end(), m_fromKey.begin(), m_fromKey.end()))
+                    continue;
+
+                reach(i, key.data(), length - 1);
+            }
+        }
+    }
+
+    side->levelBegin = levelEnd;
+
+    return meetings;
+}
+
+const char *LadderSearch::resolve(const char *key, int length) const
+{
+    // the words may be not in the dictionary
+    if(length == static_cast<int>(m_toKey.length()) && !std::memcmp(key, m_toKey.data(), length))
+        return m_toKey.c_str();
+
+    if(length == static_cast<int>(m_fromKey.length()) && !std::memcmp(key, m_fromKey.data(), length))
+        return m_fromKey.c_str();
+
+    const DictionaryIndex::Group group = m_index.group(key, length);
+
+    return group.isEmpty() ? nullptr : group.key();
+}
+
+void LadderSearch::collectChains(const Side &forward, int forwardNode, const Side &backward, int backwardNode,
+                                 int maxChains, LongestPaths *chains) const
+{
+    // the words from the meeting back to the first word, and from the meeting to the last word
+    std::vector<std::string> head;
+    std::vector<std::string> tail;
+    std::function<void(int)> walkHead;
+    std::function<void(int)> walkTail;
+
+    auto isFull = [&]() {
+        return maxChains >= 0 && chains->size() >= maxChains;
+    };
+
+    walkTail = [&](int node) {
+        const Node &current = backward.nodes[node];
+
+        tail.push_back(wordOf(current));
+
+        if(current.parents.empty() && !isFull())
+        {
+            LongestPath chain;
+            chain.reserve(static_cast<int>(head.size() + tail.size() - 1));
+
+            for(auto it = head.rbegin();it != head.rend();++it)
+                chain.push(*it);
+
+            // the meeting is already in the head
+            for(std::size_t i = 1;i < tail.size();i++)
+                chain.push(tail[i]);
+
+            chains->append(chain);
+        }
+
+        for(std::size_t i = 0;i < current.parents.size() && !isFull();i++)
+            walkTail(current.parents[i]);
+
+        tail.pop_back();
+    };
+
+    walkHead = [&](int node) {
+        const Node &current = forward.nodes[node];
+
+        head.push_back(wordOf(current));
+
+        if(current.parents.empty())
+            walkTail(backwardNode);
+
+        for(std::size_t i = 0;i < current.parents.size() && !isFull();i++)
+            walkHead(current.parents[i]);
+
+        head.pop_back();
+    };
+
+    if(!isFull())
+        walkHead(forwardNode);
+}
+
+std::string LadderSearch::wordOf(const Node &node) const
+{
+    if(node.key == m_fromKey.c_str())
+        return m_from;
+
+    if(node.key == m_toKey.c_str())
+        return m_to;
+
+    // the first word of the group, like the chains of AnagramSearch
+    return m_index.group(node.key, node.length).wordString(0);
+}
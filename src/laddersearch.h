@@ -0,0 +1,122 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LADDERSEARCH_H
+#define LADDERSEARCH_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dictionaryindex.h"
+#include "longestpaths.h"
+#include "searchstatistics.h"
+
+/*
+ *  The shortest chains from one word to another. Every step adds a letter, or also removes
+ *  one when the removals are allowed. The search is a bidirectional breadth-first search:
+ *  the forward side adds letters to the first word, the backward side removes letters from
+ *  the last word (the steps reversed), and the side with the smaller frontier expands next
+ *  level. The search stops at the first level where the sides meet, so it expands only the
+ *  words around the two ends instead of the whole graph:
+ *
+ *  LadderSearch ladder(index);
+ *  LongestPaths chains = ladder.find("owl", "bowler");
+ *
+ *  owl -> bowl -> bowel -> bowler
+ *
+ *  When only the additions are allowed, every word of the chain contains the first word
+ *  and is contained in the last one, so the other keys are not even probed
+ */
+class LadderSearch
+{
+public:
+    explicit LadderSearch(const DictionaryIndex &index);
+
+    /*
+     *  Allow the steps removing a letter
+     */
+    void setAllowRemovals(bool allow);
+
+    /*
+     *  Find up to 'maxChains' shortest chains from the first word to the last one, all of them
+     *  if 'maxChains' is negative. Unlike AnagramSearch, the chains include both words, and the
+     *  words don't have to be in the dictionary. If the words are anagrams, the only chain
+     *  is the first word. The counters of the search are saved into 'statistics' if it's
+     *  not null. Every depth is a level expanded by one of the sides
+     */
+    LongestPaths find(const QString &from, const QString &to, int maxChains = 1, SearchStatistics *statistics = nullptr);
+
+private:
+    /*
+     *  A key reached by one of the sides. The keys point into the index,
+     *  except for the keys of the two words
+     */
+    struct Node
+    {
+        const char *key;
+        int length;
+        // the keys of the previous level this key is reached from
+        std::vector<int> parents;
+    };
+
+    struct Side
+    {
+        std::vector<Node> nodes;
+        // key -> node. Keys are unique, so we compare their addresses
+        std::unordered_map<const char *, int> lookup;
+        // the nodes of the last level
+        std::size_t levelBegin;
+    };
+
+    /*
+     *  Expand the last level of the side. Returns the new nodes also reached by the other side
+     */
+    std::vector<int> expand(Side *side, const Side &other, bool forward, DepthStatistics *counters);
+
+    /*
+     *  The key of one of the words, the key in the index, or null
+     */
+    const char *resolve(const char *key, int length) const;
+
+    /*
+     *  Append the chains through the key where the sides meet, up to 'maxChains' in total
+     */
+    void collectChains(const Side &forward, int forwardNode, const Side &backward, int backwardNode,
+                       int maxChains, LongestPaths *chains) const;
+
+    std::string wordOf(const Node &node) const;
+
+private:
+    DictionaryIndex m_index;
+    bool m_allowRemovals;
+    // the words and their sorted keys of the current search
+    std::string m_from;
+    std::string m_to;
+    std::string m_fromKey;
+    std::string m_toKey;
+};
+
+#endif // LADDERSEARCH_H
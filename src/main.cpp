@@ -26,6 +26,7 @@
 #include <QtWidgets>
 
 #include "mainwindow.h"
+#include "tracer.h"
 
 /*
  *  This is the algorithm used to search anagram derivations:
@@ -130,14 +131,22 @@
  *    non-English characters, using QString (which is UTF-16 internally) is a huge overhead. Using
  *    std::string allows to greatly improve the performance of the search algorithm
  *  - The search time displayed in the app doesn't include the time required to read and parse
- *    a dictionary
+ *    a dictionary. Set ANAGRAMS_TRACE to trace all the phases, see Tracer
  */
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
 
+    // opt-in timeline of the load, search and render phases
+    if(qEnvironmentVariableIsSet("ANAGRAMS_TRACE"))
+        Tracer::instance()->start(QString::fromLocal8Bit(qgetenv("ANAGRAMS_TRACE")));
+
     MainWindow w;
     w.show();
 
-    return a.exec();
+    const int code = a.exec();
+
+    Tracer::instance()->save();
+
+    return code;
 }
@@ -25,8 +25,11 @@
 
 #include "dictionaryloader.h"
 #include "anagramfinder.h"
+#include "resultstore.h"
+#include "querylog.h"
 #include "mainwindow.h"
 #include "settings.h"
+#include "tracer.h"
 #include "options.h"
 #include "utils.h"
 #include "about.h"
@@ -35,21 +38,49 @@
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
+    , m_loadedUseIndexFile(false)
+    , m_liveResultValid(false)
 {
     ui->setupUi(this);
 
+    m_memoryLabel = new QLabel(this);
+    ui->statusbar->addPermanentWidget(m_memoryLabel);
+
+    // live mode
+    m_liveWord = new QLineEdit(this);
+    m_liveWord->setPlaceholderText(tr("Type a word"));
+    m_liveWord->setValidator(new QRegExpValidator(Settings::seedValidator(), m_liveWord));
+
+    m_liveBar = addToolBar(tr("Live search"));
+    m_liveBar->setMovable(false);
+    m_liveBar->addWidget(new QLabel(tr("Word:") + ' ', m_liveBar));
+    m_liveBar->addWidget(m_liveWord);
+    m_liveBar->hide();
+
+    // wait for a pause in typing before starting a query
+    m_liveTimer.setSingleShot(true);
+    m_liveTimer.setInterval(150);
+
+    connect(m_liveWord, SIGNAL(textEdited(QString)), this, SLOT(slotLiveWordEdited()));
+    connect(&m_liveTimer, SIGNAL(timeout()), this, SLOT(slotLiveQuery()));
+    connect(&m_liveWatcher, SIGNAL(finished()), this, SLOT(slotLiveQueryFinished()));
+
     // PROJECT_* strings are defined in the cmake project file
     setWindowTitle(tr(PROJECT_LABEL));
 
     ui->actionStart_test->setShortcut(QKeySequence::New);
     ui->actionQuit->setShortcut(QKeySequence::Quit);
     ui->actionAbout->setShortcut(QKeySequence::HelpContents);
+    ui->actionLive_search->setShortcut(Qt::CTRL + Qt::Key_L);
 
     QTimer::singleShot(0, this, SLOT(slotConfigureAndStart()));
 }
 
 MainWindow::~MainWindow()
 {
+    // don't keep the pool busy with a query nobody waits for
+    m_liveWatcher.future().cancel();
+
     delete ui;
 }
 
@@ -57,34 +88,261 @@ void MainWindow::loadDictionary()
 {
     qDebug("Load dictionary");
 
-    // parse the selected dictionary
-    DictionaryLoader loader(SETTINGS_GET_STRING(SETTING_DICTIONARY), this);
+    TraceSpan span("load-dictionary");
+
+    const QString dictionaryPath = SETTINGS_GET_STRING(SETTING_DICTIONARY);
+    const bool useIndexFile = SETTINGS_GET_BOOL(SETTING_INDEX_FILE);
 
-    if(loader.error())
+    // the same unchanged dictionary is just searched again
+    if(!isDictionaryLoaded(dictionaryPath, useIndexFile))
     {
-        Utils::error(tr("Cannot open the selected dictionary: %1").arg(loader.errorString()), this);
-        return;
-    }
+        m_loadedDictionaryPath.clear();
 
-    if(loader.exec() != DictionaryLoader::Accepted)
-        return;
+        // the live results belong to the previous dictionary
+        resetLiveSearch();
+
+        // the dictionary is usually preloaded while the options are open
+        ui->statusbar->showMessage(tr("Loading the dictionary..."));
+        setEnabled(false);
+
+        m_index = m_preloader.take(dictionaryPath, useIndexFile);
+
+        setEnabled(true);
+        ui->statusbar->clearMessage();
+
+        // the dictionary may have been already indexed by another process
+        // or in one of the previous sessions, just map the index then
+        if(m_index.isNull() && useIndexFile)
+            m_index = DictionaryIndex::mapFile(dictionaryPath);
+
+        if(m_index.isNull())
+        {
+            // parse the selected dictionary
+            DictionaryLoader loader(dictionaryPath, this);
+
+            if(loader.error())
+            {
+                Utils::error(tr("Cannot open the selected dictionary: %1").arg(loader.errorString()), this);
+                return;
+            }
+
+            {
+                TraceSpan loaderSpan("dictionary-loader");
+
+                if(loader.exec() != DictionaryLoader::Accepted)
+                    return;
+            }
 
-    // parsed dictionary
-    m_anagrams = loader.anagrams();
+            // parsed dictionary
+            m_index = DictionaryIndex::build(loader.anagrams(), loader.fingerprint());
+
+            if(m_index.isNull())
+            {
+                Utils::error(tr("Cannot index the selected dictionary"), this);
+                return;
+            }
+
+            // save the index and map it back, so the memory is shared with other processes
+            if(useIndexFile && m_index.saveFile(dictionaryPath))
+            {
+                const DictionaryIndex mapped = DictionaryIndex::mapFile(dictionaryPath);
+
+                if(!mapped.isNull())
+                    m_index = mapped;
+            }
+        }
+
+        m_loadedDictionaryPath = dictionaryPath;
+        m_loadedUseIndexFile = useIndexFile;
+        m_loadedLastModified = QFileInfo(dictionaryPath).lastModified();
+    }
+
+    updateMemoryStatus();
 
     QString word = SETTINGS_GET_STRING(SETTING_WORD);
+    const bool profileSearch = SETTINGS_GET_BOOL(SETTING_PROFILE_SEARCH);
+    const SearchConstraints constraints = searchConstraints();
+
+    // the results never change for the same dictionary, so check if
+    // we have already computed them in one of the previous sessions.
+    // A profiled search must run anyway, and the store doesn't keep
+    // the results of the constrained searches
+    QScopedPointer<ResultStore> store;
+    const std::string key = ResultStore::keyForWord(word);
+
+    if(SETTINGS_GET_BOOL(SETTING_RESULT_STORE) && !profileSearch && constraints.isEmpty())
+    {
+        QElapsedTimer storeTimeCounter;
+        storeTimeCounter.start();
+
+        store.reset(new ResultStore(dictionaryPath, m_index.fingerprint()));
+
+        LongestPaths paths;
+
+        if(store->find(key, &paths))
+        {
+            qDebug("Found the results in the result store");
+
+            const qint64 storeTime = storeTimeCounter.elapsed();
+
+            ui->searchResults->loadResults(word, paths, storeTime);
+            logQuery(dictionaryPath, word, paths, storeTime, true);
+            return;
+        }
+    }
 
     // search anagrams we need in the parsed dictionary
-    AnagramFinder finder(m_anagrams, word, this);
+    AnagramFinder finder(m_index, word, constraints, profileSearch, this);
+
+    // display the chains while the search is still running
+    ui->searchResults->follow(word, finder.chainStream());
 
-    if(finder.exec() != AnagramFinder::Accepted)
     {
-        ui->searchResults->clear();
-        return;
+        TraceSpan finderSpan("anagram-finder", word);
+
+        if(finder.exec() != AnagramFinder::Accepted)
+        {
+            ui->searchResults->clear();
+            return;
+        }
     }
 
+    const LongestPaths paths = finder.longestPaths();
+
+    if(store)
+        store->append(key, paths);
+
     // finally, display results
-    ui->searchResults->loadResults(word, finder.longestPaths(), finder.algorithmTime());
+    ui->searchResults->loadResults(word, paths, finder.algorithmTime(), finder.statistics());
+
+    updateMemoryStatus(finder.statistics());
+
+    const SearchProfile profile = finder.profile();
+
+    if(!profile.isEmpty())
+        showProfile(word, profile);
+
+    logQuery(dictionaryPath, word, paths, finder.algorithmTime(), false);
+}
+
+void MainWindow::showProfile(const QString &word, const SearchProfile &profile)
+{
+    qDebug("Search profile:\n%s", qPrintable(profile.toString()));
+
+    QDialog *dialog = new QDialog(this);
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->setWindowTitle(tr("Search profile: %1").arg(word));
+
+    QPlainTextEdit *report = new QPlainTextEdit(profile.toString(), dialog);
+    report->setReadOnly(true);
+    report->setLineWrapMode(QPlainTextEdit::NoWrap);
+    report->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+    QVBoxLayout *layout = new QVBoxLayout(dialog);
+    layout->addWidget(report);
+
+    dialog->resize(720, 480);
+    dialog->show();
+}
+
+void MainWindow::logQuery(const QString &dictionaryPath, const QString &word, const LongestPaths &paths, qint64 time, bool cached)
+{
+    if(!SETTINGS_GET_BOOL(SETTING_QUERY_LOG))
+        return;
+
+    QueryLogEntry entry;
+
+    entry.timestamp = QDateTime::currentDateTime();
+    entry.source = "app";
+    entry.dictionary = dictionaryPath;
+    entry.fingerprint = m_index.fingerprint();
+    entry.word = word;
+    entry.options["search_threads"] = SearchPool::instance()->maxThreadCount();
+    entry.options["result_store"] = SETTINGS_GET_BOOL(SETTING_RESULT_STORE);
+    entry.options["index_file"] = SETTINGS_GET_BOOL(SETTING_INDEX_FILE);
+
+    const SearchConstraints constraints = searchConstraints();
+
+    if(!constraints.isEmpty())
+        entry.options["constraints"] = constraints.toJson();
+
+    entry.timeMs = time;
+    entry.chains = paths.size();
+    entry.length = paths.isEmpty() ? 0 : paths.first().size();
+    entry.cached = cached;
+
+    QueryLog(QueryLog::defaultPath()).append(entry);
+}
+
+SearchConstraints MainWindow::searchConstraints() const
+{
+    SearchConstraints constraints;
+
+    constraints.excludedLetters = SETTINGS_GET_STRING(SETTING_EXCLUDED_LETTERS);
+    constraints.requiredLetters = SETTINGS_GET_STRING(SETTING_REQUIRED_LETTERS);
+    constraints.maxLength = SETTINGS_GET_INT(SETTING_MAX_WORD_LENGTH);
+    constraints.maxStep = SETTINGS_GET_INT(SETTING_MAX_STEP);
+
+    return constraints;
+}
+
+void MainWindow::resetLiveSearch()
+{
+    m_liveTimer.stop();
+
+    if(m_liveWatcher.isRunning())
+    {
+        m_liveWatcher.future().cancel();
+        ui->searchResults->clear();
+    }
+
+    m_liveQueryWord.clear();
+    m_liveKey.clear();
+    m_liveResult = QueryResult();
+    m_liveResultValid = false;
+}
+
+void MainWindow::updateMemoryStatus(const SearchStatistics &statistics)
+{
+    const MemoryUsage indexUsage = m_index.memoryUsage();
+
+    m_memoryLabel->setText(tr("Index: %1 group(s), %2 word(s), %3")
+                           .arg(m_index.size())
+                           .arg(m_index.wordCount())
+                           .arg(MemoryUsage::formatBytes(indexUsage.total())));
+
+    QString toolTip = memoryTable(tr("Dictionary index"), indexUsage);
+
+    if(!statistics.memory.isEmpty())
+        toolTip += memoryTable(tr("Last search"), statistics.memory);
+
+    m_memoryLabel->setToolTip(toolTip);
+}
+
+QString MainWindow::memoryTable(const QString &title, const MemoryUsage &usage) const
+{
+    QString result = "<b>" + title + "</b><table>";
+
+    for(const MemoryUsage::Component &component : usage.components)
+    {
+        result += QString("<tr><td>%1</td><td align=right>%2</td><td align=right>%3</td></tr>")
+                    .arg(component.name.toHtmlEscaped())
+                    .arg(MemoryUsage::formatBytes(component.bytes))
+                    .arg(component.items ? tr("%1 item(s)").arg(component.items) : QString());
+    }
+
+    return result + QString("<tr><td><b>%1</b></td><td align=right><b>%2</b></td><td></td></tr></table>")
+                        .arg(tr("Total"))
+                        .arg(MemoryUsage::formatBytes(usage.total()));
+}
+
+bool MainWindow::isDictionaryLoaded(const QString &dictionaryPath, bool useIndexFile) const
+{
+    return !m_index.isNull()
+            && !m_loadedDictionaryPath.isEmpty()
+            && m_loadedDictionaryPath == dictionaryPath
+            && m_loadedUseIndexFile == useIndexFile
+            && QFileInfo(dictionaryPath).lastModified() == m_loadedLastModified;
 }
 
 void MainWindow::slotAbout()
@@ -105,10 +363,111 @@ void MainWindow::slotConfigureAndStart()
 {
     qDebug("Configure and start");
 
+    const QString dictionaryPath = SETTINGS_GET_STRING(SETTING_DICTIONARY);
+    const bool useIndexFile = SETTINGS_GET_BOOL(SETTING_INDEX_FILE);
+
+    // load the last dictionary while the user is looking at the options,
+    // unless it's already loaded
+    if(!isDictionaryLoaded(dictionaryPath, useIndexFile))
+        m_preloader.start(dictionaryPath, useIndexFile);
+
     Options options(this);
 
     if(options.exec() == Options::Accepted)
         loadDictionary();
+    else
+        m_preloader.cancel();
+}
+
+void MainWindow::slotLiveSearch(bool enabled)
+{
+    qDebug("Live search: %s", enabled ? "on" : "off");
+
+    m_liveBar->setVisible(enabled);
+
+    if(!enabled)
+    {
+        resetLiveSearch();
+        return;
+    }
+
+    if(m_liveWord->text().isEmpty())
+        m_liveWord->setText(SETTINGS_GET_STRING(SETTING_WORD));
+
+    m_liveWord->setFocus();
+    m_liveWord->selectAll();
+
+    if(m_index.isNull())
+        ui->statusbar->showMessage(tr("Start a new search to load a dictionary"));
+}
+
+void MainWindow::slotLiveWordEdited()
+{
+    // restart the countdown on every edit
+    m_liveTimer.start();
+}
+
+void MainWindow::slotLiveQuery()
+{
+    if(m_index.isNull())
+    {
+        ui->statusbar->showMessage(tr("Start a new search to load a dictionary"));
+        return;
+    }
+
+    const QString word = m_liveWord->text().toLower();
+
+    if(word.length() < Settings::minimumWordLength())
+    {
+        resetLiveSearch();
+        ui->searchResults->clear();
+        return;
+    }
+
+    const SearchConstraints constraints = searchConstraints();
+    const std::string key = ResultStore::keyForWord(word) + '|' + constraints.toString().toStdString();
+
+    m_liveQueryWord = word;
+
+    // the same letters give the same chains, only the starting word
+    // is different. If the query is still running, it displays its
+    // chains with the new word when it finishes
+    if(key == m_liveKey)
+    {
+        if(m_liveResultValid)
+            ui->searchResults->loadResults(word, m_liveResult.longestPaths, m_liveResult.algorithmTime, m_liveResult.statistics);
+
+        return;
+    }
+
+    qDebug("Live query for \"%s\"", qPrintable(word));
+
+    // the running query is obsolete. The search checks the cancel flag
+    // every few thousand expansions, so the worker is freed quickly
+    m_liveWatcher.future().cancel();
+
+    m_liveKey = key;
+    m_liveResultValid = false;
+
+    QSharedPointer<ChainStream> stream(new ChainStream);
+    ui->searchResults->follow(word, stream);
+
+    m_liveWatcher.setFuture(SearchPool::instance()->submit(m_index, word, false, stream, constraints));
+}
+
+void MainWindow::slotLiveQueryFinished()
+{
+    // canceled futures have no result
+    if(m_liveWatcher.isCanceled())
+        return;
+
+    m_liveResult = m_liveWatcher.result();
+    m_liveResultValid = true;
+
+    ui->searchResults->loadResults(m_liveQueryWord, m_liveResult.longestPaths, m_liveResult.algorithmTime, m_liveResult.statistics);
+
+    updateMemoryStatus(m_liveResult.statistics);
+    logQuery(SETTINGS_GET_STRING(SETTING_DICTIONARY), m_liveQueryWord, m_liveResult.longestPaths, m_liveResult.algorithmTime, false);
 }
 
 void MainWindow::slotQuit()
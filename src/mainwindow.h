@@ -28,7 +28,12 @@
 
 #include <QtWidgets>
 
-#include "anagrams.h"
+#include "dictionarypreloader.h"
+#include "dictionaryindex.h"
+#include "searchstatistics.h"
+#include "searchprofile.h"
+#include "longestpaths.h"
+#include "searchpool.h"
 
 namespace Ui
 {
@@ -53,15 +58,74 @@ private:
      */
     void loadDictionary();
 
+    /*
+     *  Display the memory used by the index and by the last search in the status bar
+     */
+    void updateMemoryStatus(const SearchStatistics &statistics = SearchStatistics());
+
+    QString memoryTable(const QString &title, const MemoryUsage &usage) const;
+
+    /*
+     *  Display the profile report in a separate window
+     */
+    void showProfile(const QString &word, const SearchProfile &profile);
+
+    /*
+     *  Append the query to the query log if enabled
+     */
+    void logQuery(const QString &dictionaryPath, const QString &word, const LongestPaths &paths, qint64 time, bool cached);
+
+    /*
+     *  Constraints of the search from the settings
+     */
+    SearchConstraints searchConstraints() const;
+
+    /*
+     *  Cancel the running live query, and forget the last live result
+     */
+    void resetLiveSearch();
+
+    /*
+     *  True if the index holds the dictionary loaded with the same parameters,
+     *  and the dictionary has not changed since then
+     */
+    bool isDictionaryLoaded(const QString &dictionaryPath, bool useIndexFile) const;
+
 private slots:
     void slotAbout();
     void slotAboutQt();
     void slotConfigureAndStart();
     void slotQuit();
 
+    /*
+     *  Live mode: every edit of the word starts a background query
+     *  against the loaded dictionary
+     */
+    void slotLiveSearch(bool enabled);
+    void slotLiveWordEdited();
+    void slotLiveQuery();
+    void slotLiveQueryFinished();
+
 private:
     Ui::MainWindow *ui;
-    Anagrams m_anagrams;
+    DictionaryIndex m_index;
+    // the dictionary the index was loaded from
+    QString m_loadedDictionaryPath;
+    bool m_loadedUseIndexFile;
+    QDateTime m_loadedLastModified;
+    DictionaryPreloader m_preloader;
+    QLabel *m_memoryLabel;
+    // live mode
+    QToolBar *m_liveBar;
+    QLineEdit *m_liveWord;
+    QTimer m_liveTimer;
+    QFutureWatcher<QueryResult> m_liveWatcher;
+    // the word of the running or the last finished query, and its sorted key
+    QString m_liveQueryWord;
+    std::string m_liveKey;
+    // result of the last finished query, reused while the sorted word doesn't change
+    QueryResult m_liveResult;
+    bool m_liveResultValid;
 };
 
 #endif // MAINWINDOW_H
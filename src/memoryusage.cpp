@@ -0,0 +1,187 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "memoryusage.h"
+
+namespace
+{
+
+// QArrayData header of QVector, QList and QString
+constexpr qint64 ARRAY_HEADER_SIZE = sizeof(QArrayData);
+
+/*
+ *  Heap block of std::string. Short strings are stored inside the object
+ */
+qint64 stringHeapSize(const std::string &str)
+{
+    return str.capacity() > std::string().capacity() ? static_cast<qint64>(str.capacity()) + 1 : 0;
+}
+
+}
+
+void MemoryUsage::add(const QString &name, qint64 bytes, qint64 items)
+{
+    components.append({ name, bytes, items });
+}
+
+void MemoryUsage::add(const QString &prefix, const MemoryUsage &other)
+{
+    for(const Component &component : other.components)
+        add(prefix + component.name, component.bytes, component.items);
+}
+
+qint64 MemoryUsage::total() const
+{
+    qint64 result = 0;
+
+    for(const Component &component : components)
+        result += component.bytes;
+
+    return result;
+}
+
+QJsonObject MemoryUsage::toJson() const
+{
+    QJsonArray array;
+
+    for(const Component &component : components)
+    {
+        QJsonObject object;
+
+        object["name"] = component.name;
+        object["bytes"] = static_cast<double>(component.bytes);
+        object["items"] = static_cast<double>(component.items);
+
+        array.append(object);
+    }
+
+    QJsonObject object;
+
+    object["total_bytes"] = static_cast<double>(total());
+    object["components"] = array;
+
+    return object;
+}
+
+QString MemoryUsage::toString() const
+{
+    QString result;
+    int width = 5;
+
+    for(const Component &component : components)
+        width = std::max(width, component.name.length());
+
+    for(const Component &component : components)
+    {
+        result += component.name.leftJustified(width + 2)
+                + formatBytes(component.bytes).rightJustified(12);
+
+        if(component.items)
+            result += QString::number(component.items).rightJustified(14) + " items";
+
+        result += '\n';
+    }
+
+    return result + QString("total").leftJustified(width + 2) + formatBytes(total()).rightJustified(12) + '\n';
+}
+
+QString MemoryUsage::formatBytes(qint64 bytes)
+{
+    if(bytes < 1024)
+        return QString("%1 B").arg(bytes);
+    else if(bytes < 1024 * 1024)
+        return QString("%1 KB").arg(bytes / 1024.0, 0, 'f', 1);
+    else
+        return QString("%1 MB").arg(bytes / (1024.0 * 1024.0), 0, 'f', 1);
+}
+
+MemoryUsage MemoryUsage::ofAnagrams(const Anagrams &anagrams)
+{
+    // QHash node: next pointer, hash, key, value
+    struct Node
+    {
+        void *next;
+        uint hash;
+        std::string key;
+        QVector<std::string> value;
+    };
+
+    qint64 keyHeap = 0;
+    qint64 vectorBlocks = 0;
+    qint64 wordObjects = 0;
+    qint64 wordHeap = 0;
+    qint64 words = 0;
+
+    for(auto it = anagrams.constBegin();it != anagrams.constEnd();++it)
+    {
+        keyHeap += stringHeapSize(it.key());
+        vectorBlocks += ARRAY_HEADER_SIZE;
+        wordObjects += static_cast<qint64>(it.value().capacity()) * sizeof(std::string);
+        words += it.value().size();
+
+        for(const std::string &word : it.value())
+            wordHeap += stringHeapSize(word);
+    }
+
+    MemoryUsage result;
+
+    result.add("hash buckets", static_cast<qint64>(anagrams.capacity()) * sizeof(void *), anagrams.capacity());
+    result.add("hash nodes", static_cast<qint64>(anagrams.size()) * sizeof(Node), anagrams.size());
+    result.add("key strings", keyHeap, anagrams.size());
+    result.add("vector headers", vectorBlocks, anagrams.size());
+    result.add("word objects", wordObjects, words);
+    result.add("word strings", wordHeap, words);
+
+    return result;
+}
+
+MemoryUsage MemoryUsage::ofPaths(const LongestPaths &paths)
+{
+    qint64 stacks = 0;
+    qint64 wordObjects = 0;
+    qint64 wordHeap = 0;
+    qint64 words = 0;
+
+    for(const LongestPath &path : paths)
+    {
+        stacks += ARRAY_HEADER_SIZE;
+        wordObjects += static_cast<qint64>(path.capacity()) * sizeof(std::string);
+        words += path.size();
+
+        for(const std::string &word : path)
+            wordHeap += stringHeapSize(word);
+    }
+
+    MemoryUsage result;
+
+    // QStack is a pointer-sized movable type, so QList keeps it in place
+    result.add("chain list", ARRAY_HEADER_SIZE + static_cast<qint64>(paths.size()) * sizeof(LongestPath), paths.size());
+    result.add("chain vectors", stacks + wordObjects, words);
+    result.add("chain strings", wordHeap, words);
+
+    return result;
+}
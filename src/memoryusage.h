@@ -0,0 +1,99 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include <QtCore>
+
+#include "anagrams.h"
+#include "longestpaths.h"
+
+/*
+ *  Memory used by a data structure, broken down by components like
+ *
+ *  keys          1'234'567 bytes   100'000 items
+ *  words         2'345'678 bytes   150'000 items
+ *  buckets         524'288 bytes   131'072 items
+ *  ...
+ *
+ *  Sizes of the Qt and std containers are estimated from their layout and
+ *  don't include the overhead of the allocator
+ */
+struct MemoryUsage
+{
+    struct Component
+    {
+        QString name;
+        qint64 bytes;
+        qint64 items;
+    };
+
+    void add(const QString &name, qint64 bytes, qint64 items = 0);
+
+    /*
+     *  Append the components of another report with the prefix
+     */
+    void add(const QString &prefix, const MemoryUsage &other);
+
+    qint64 total() const;
+
+    inline
+    bool isEmpty() const;
+
+    QJsonObject toJson() const;
+
+    /*
+     *  Plain text table
+     */
+    QString toString() const;
+
+    /*
+     *  Convert 1536 to "1.5 KB"
+     */
+    static
+    QString formatBytes(qint64 bytes);
+
+    /*
+     *  Estimated memory of the parsed dictionary
+     */
+    static
+    MemoryUsage ofAnagrams(const Anagrams &anagrams);
+
+    /*
+     *  Estimated memory of the search results
+     */
+    static
+    MemoryUsage ofPaths(const LongestPaths &paths);
+
+    QVector<Component> components;
+};
+
+bool MemoryUsage::isEmpty() const
+{
+    return components.isEmpty();
+}
+
+#endif // MEMORYUSAGE_H
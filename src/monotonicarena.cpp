@@ -0,0 +1,109 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include "monotonicarena.h"
+
+// blocks grow geometrically up to this size
+static constexpr std::size_t MAX_BLOCK_SIZE = 16 * 1024 * 1024;
+
+MonotonicArena::MonotonicArena(std::size_t initialBlockSize)
+    : m_blocks(nullptr)
+    , m_current(nullptr)
+    , m_end(nullptr)
+    , m_nextBlockSize(initialBlockSize)
+    , m_reservedSize(0)
+{}
+
+MonotonicArena::~MonotonicArena()
+{
+    while(m_blocks)
+    {
+        Block *next = m_blocks->next;
+        std::free(m_blocks);
+        m_blocks = next;
+    }
+}
+
+void MonotonicArena::release()
+{
+    if(!m_blocks)
+        return;
+
+    // keep the largest block. It's not always the newest one, since an oversized
+    // allocation may get a large block followed by the regular ones
+    Block *largest = m_blocks;
+
+    for(Block *block = m_blocks->next;block;block = block->next)
+    {
+        if(block->size > largest->size)
+            largest = block;
+    }
+
+    Block *block = m_blocks;
+
+    while(block)
+    {
+        Block *next = block->next;
+
+        if(block != largest)
+        {
+            m_reservedSize -= block->size;
+            std::free(block);
+        }
+
+        block = next;
+    }
+
+    largest->next = nullptr;
+    m_blocks = largest;
+    m_current = reinterpret_cast<char *>(largest + 1);
+    m_end = reinterpret_cast<char *>(largest) + largest->size;
+}
+
+void *MonotonicArena::allocateFromNewBlock(std::size_t size, std::size_t alignment)
+{
+    const std::size_t required = sizeof(Block) + size + alignment;
+    const std::size_t blockSize = std::max(m_nextBlockSize, required);
+
+    Block *block = static_cast<Block *>(std::malloc(blockSize));
+
+    if(!block)
+        throw std::bad_alloc();
+
+    block->next = m_blocks;
+    block->size = blockSize;
+
+    m_blocks = block;
+    m_current = reinterpret_cast<char *>(block + 1);
+    m_end = reinterpret_cast<char *>(block) + blockSize;
+    m_nextBlockSize = std::min(m_nextBlockSize * 2, MAX_BLOCK_SIZE);
+    m_reservedSize += blockSize;
+
+    return allocate(size, alignment);
+}
@@ -0,0 +1,147 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef MONOTONICARENA_H
+#define MONOTONICARENA_H
+
+#include <QtGlobal>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ *  Scratch memory of a single query. Allocation is a pointer bump, deallocation
+ *  is a no-op, and all the memory is released in one shot with release(). This way
+ *  concurrent queries don't contend on the global allocator
+ */
+class MonotonicArena
+{
+public:
+    explicit MonotonicArena(std::size_t initialBlockSize = 64 * 1024);
+    ~MonotonicArena();
+
+    inline
+    void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    /*
+     *  Release all the allocations at once. The largest block is kept
+     *  for the next query to avoid going to the allocator again
+     */
+    void release();
+
+    /*
+     *  Total size of the blocks obtained from the system
+     */
+    inline
+    std::size_t reservedSize() const;
+
+private:
+    void *allocateFromNewBlock(std::size_t size, std::size_t alignment);
+
+    struct Block
+    {
+        Block *next;
+        std::size_t size;
+    };
+
+    Q_DISABLE_COPY(MonotonicArena)
+
+private:
+    Block *m_blocks;
+    char *m_current;
+    char *m_end;
+    std::size_t m_nextBlockSize;
+    std::size_t m_reservedSize;
+};
+
+/*
+ *  Standard allocator on top of MonotonicArena to use the arena with std containers
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena *arena)
+        : m_arena(arena)
+    {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other)
+        : m_arena(other.arena())
+    {}
+
+    T *allocate(std::size_t n)
+    {
+        return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, std::size_t)
+    {
+        // everything is released with the arena
+    }
+
+    MonotonicArena *arena() const
+    {
+        return m_arena;
+    }
+
+private:
+    MonotonicArena *m_arena;
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b)
+{
+    return a.arena() == b.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b)
+{
+    return a.arena() != b.arena();
+}
+
+void *MonotonicArena::allocate(std::size_t size, std::size_t alignment)
+{
+    const std::uintptr_t current = reinterpret_cast<std::uintptr_t>(m_current);
+    const std::uintptr_t aligned = (current + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+    if(m_current && aligned + size <= reinterpret_cast<std::uintptr_t>(m_end))
+    {
+        m_current = reinterpret_cast<char *>(aligned + size);
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    return allocateFromNewBlock(size, alignment);
+}
+
+std::size_t MonotonicArena::reservedSize() const
+{
+    return m_reservedSize;
+}
+
+#endif // MONOTONICARENA_H
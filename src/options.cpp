@@ -25,6 +25,8 @@
 
 #include <QtWidgets>
 
+#include "searchpool.h"
+#include "querylog.h"
 #include "settings.h"
 #include "options.h"
 #include "ui_options.h"
@@ -41,7 +43,20 @@ Options::Options(QWidget *parent) :
 
     ui->lineWord->setText(SETTINGS_GET_STRING(SETTING_WORD));
     ui->lineWord->setCursorPosition(0);
-    ui->lineWord->setValidator(new QRegExpValidator(Settings::wordValidator(), ui->lineWord));
+    ui->lineWord->setValidator(new QRegExpValidator(Settings::seedValidator(), ui->lineWord));
+
+    ui->spinThreads->setValue(SETTINGS_GET_INT(SETTING_SEARCH_THREADS));
+    ui->lineExcluded->setText(SETTINGS_GET_STRING(SETTING_EXCLUDED_LETTERS));
+    ui->lineExcluded->setValidator(new QRegExpValidator(QRegExp("[a-zA-Z]*"), ui->lineExcluded));
+    ui->lineRequired->setText(SETTINGS_GET_STRING(SETTING_REQUIRED_LETTERS));
+    ui->lineRequired->setValidator(new QRegExpValidator(QRegExp("[a-zA-Z]*"), ui->lineRequired));
+    ui->spinMaxLength->setValue(SETTINGS_GET_INT(SETTING_MAX_WORD_LENGTH));
+    ui->spinMaxStep->setValue(SETTINGS_GET_INT(SETTING_MAX_STEP));
+    ui->checkResultStore->setChecked(SETTINGS_GET_BOOL(SETTING_RESULT_STORE));
+    ui->checkIndexFile->setChecked(SETTINGS_GET_BOOL(SETTING_INDEX_FILE));
+    ui->checkQueryLog->setChecked(SETTINGS_GET_BOOL(SETTING_QUERY_LOG));
+    ui->checkProfileSearch->setChecked(SETTINGS_GET_BOOL(SETTING_PROFILE_SEARCH));
+    ui->checkQueryLog->setToolTip(ui->checkQueryLog->toolTip() + "\n" + QDir::toNativeSeparators(QueryLog::defaultPath()));
 
     ui->toolDictionary->setIcon(QIcon::fromTheme("folder-open", QIcon(":/images/folder.png")));
     ui->buttonBox->button(QDialogButtonBox::Ok)->setText(tr("Start"));
@@ -94,6 +109,17 @@ void Options::slotAccept()
 {
     SETTINGS_SET_STRING(SETTING_DICTIONARY, dictionary());
     SETTINGS_SET_STRING(SETTING_WORD, word());
+    SETTINGS_SET_INT(SETTING_SEARCH_THREADS, ui->spinThreads->value());
+    SETTINGS_SET_STRING(SETTING_EXCLUDED_LETTERS, ui->lineExcluded->text().toLower());
+    SETTINGS_SET_STRING(SETTING_REQUIRED_LETTERS, ui->lineRequired->text().toLower());
+    SETTINGS_SET_INT(SETTING_MAX_WORD_LENGTH, ui->spinMaxLength->value());
+    SETTINGS_SET_INT(SETTING_MAX_STEP, ui->spinMaxStep->value());
+    SETTINGS_SET_BOOL(SETTING_RESULT_STORE, ui->checkResultStore->isChecked());
+    SETTINGS_SET_BOOL(SETTING_INDEX_FILE, ui->checkIndexFile->isChecked());
+    SETTINGS_SET_BOOL(SETTING_QUERY_LOG, ui->checkQueryLog->isChecked());
+    SETTINGS_SET_BOOL(SETTING_PROFILE_SEARCH, ui->checkProfileSearch->isChecked());
+
+    SearchPool::instance()->setMaxThreadCount(ui->spinThreads->value());
 
     accept();
 }
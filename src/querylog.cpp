@@ -0,0 +1,138 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "querylog.h"
+
+namespace
+{
+
+// serializes the appends of all the logs in the process
+QMutex logMutex;
+
+}
+
+QJsonObject QueryLogEntry::toJson() const
+{
+    QJsonObject object;
+
+    object["timestamp"] = timestamp.toString(Qt::ISODate);
+    object["source"] = source;
+    object["dictionary"] = dictionary;
+    object["fingerprint"] = QString::fromLatin1(fingerprint.toHex());
+    object["word"] = word;
+    object["options"] = options;
+    object["time_ms"] = timeMs;
+    object["chains"] = chains;
+    object["length"] = length;
+    object["cached"] = cached;
+
+    return object;
+}
+
+QueryLogEntry QueryLogEntry::fromJson(const QJsonObject &object)
+{
+    QueryLogEntry entry;
+
+    entry.timestamp = QDateTime::fromString(object["timestamp"].toString(), Qt::ISODate);
+    entry.source = object["source"].toString();
+    entry.dictionary = object["dictionary"].toString();
+    entry.fingerprint = QByteArray::fromHex(object["fingerprint"].toString().toLatin1());
+    entry.word = object["word"].toString();
+    entry.options = object["options"].toObject();
+    entry.timeMs = object["time_ms"].toDouble();
+    entry.chains = object["chains"].toInt();
+    entry.length = object["length"].toInt();
+    entry.cached = object["cached"].toBool();
+
+    return entry;
+}
+
+QueryLog::QueryLog(const QString &path)
+    : m_path(path)
+{}
+
+bool QueryLog::append(const QueryLogEntry &entry)
+{
+    const QByteArray line = QJsonDocument(entry.toJson()).toJson(QJsonDocument::Compact) + '\n';
+
+    QMutexLocker locker(&logMutex);
+
+    QDir().mkpath(QFileInfo(m_path).absolutePath());
+
+    QFile file(m_path);
+
+    // a single write of a whole line, so the concurrent processes don't mix the lines
+    if(!file.open(QFile::WriteOnly | QFile::Append) || file.write(line) != line.size())
+    {
+        qWarning("Cannot write the query log %s: %s", qPrintable(m_path), qPrintable(file.errorString()));
+        return false;
+    }
+
+    return true;
+}
+
+QList<QueryLogEntry> QueryLog::load(const QString &path, QString *errorString)
+{
+    QList<QueryLogEntry> entries;
+    QFile file(path);
+
+    if(!file.open(QFile::ReadOnly))
+    {
+        if(errorString)
+            *errorString = file.errorString();
+
+        return entries;
+    }
+
+    int lineNumber = 0;
+
+    while(!file.atEnd())
+    {
+        const QByteArray line = file.readLine().trimmed();
+
+        lineNumber++;
+
+        if(line.isEmpty())
+            continue;
+
+        QJsonParseError error;
+        const QJsonDocument document = QJsonDocument::fromJson(line, &error);
+
+        if(error.error != QJsonParseError::NoError || !document.isObject())
+        {
+            qWarning("Skipping the damaged line %d of the query log: %s", lineNumber, qPrintable(error.errorString()));
+            continue;
+        }
+
+        entries.append(QueryLogEntry::fromJson(document.object()));
+    }
+
+    return entries;
+}
+
+QString QueryLog::defaultPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/queries.jsonl";
+}
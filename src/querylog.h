@@ -0,0 +1,93 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef QUERYLOG_H
+#define QUERYLOG_H
+
+#include <QtCore>
+
+/*
+ *  A single logged query
+ */
+struct QueryLogEntry
+{
+    QueryLogEntry()
+        : timeMs(0)
+        , chains(0)
+        , length(0)
+        , cached(false)
+    {}
+
+    QJsonObject toJson() const;
+
+    static
+    QueryLogEntry fromJson(const QJsonObject &object);
+
+    QDateTime timestamp;
+    // "app" or the name of the tool
+    QString source;
+    QString dictionary;
+    QByteArray fingerprint;
+    QString word;
+    // search options like the number of threads
+    QJsonObject options;
+    double timeMs;
+    int chains;
+    int length;
+    // the result has been served from the result store
+    bool cached;
+};
+
+/*
+ *  Optional log of the queries in the JSON Lines format, one query per line. The log
+ *  is replayed with 'anagrams_cli replay' to reproduce the real load locally
+ */
+class QueryLog
+{
+public:
+    explicit QueryLog(const QString &path);
+
+    /*
+     *  Append the entry. Safe to call from any thread. Returns false on I/O errors
+     */
+    bool append(const QueryLogEntry &entry);
+
+    /*
+     *  Read all the entries. Damaged lines are skipped
+     */
+    static
+    QList<QueryLogEntry> load(const QString &path, QString *errorString = nullptr);
+
+    /*
+     *  Log of the app in the user data directory
+     */
+    static
+    QString defaultPath();
+
+private:
+    QString m_path;
+};
+
+#endif // QUERYLOG_H
@@ -0,0 +1,59 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "anagramsearch.h"
+#include "racksearch.h"
+#include "keytrie.h"
+#include "tracer.h"
+
+RackSearch::RackSearch(const DictionaryIndex &index)
+    : m_index(index)
+{}
+
+QVector<DictionaryIndex::Group> RackSearch::find(const QString &rack, int minLength) const
+{
+    TraceSpan span("rack-search", [&rack] { return rack; });
+
+    std::string letters = rack.toLower().toStdString();
+
+    const int blanks = static_cast<int>(std::count(letters.begin(), letters.end(), AnagramSearch::BLANK));
+    letters.erase(std::remove(letters.begin(), letters.end(), AnagramSearch::BLANK), letters.end());
+
+    QVector<DictionaryIndex::Group> result;
+
+    m_index.trie().forEachSubset(letters.c_str(), static_cast<int>(letters.length()), blanks, minLength,
+                                 [&result](const DictionaryIndex::Group &group) {
+        result.append(group);
+    });
+
+    // the keys are reported in the sorted order, keep it for the same length
+    std::stable_sort(result.begin(), result.end(), [](const DictionaryIndex::Group &a, const DictionaryIndex::Group &b) {
+        return a.wordLength() > b.wordLength();
+    });
+
+    return result;
+}
@@ -0,0 +1,56 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef RACKSEARCH_H
+#define RACKSEARCH_H
+
+#include "dictionaryindex.h"
+
+/*
+ *  Sub-anagram query: the words that can be built from the letters of a rack. Every letter
+ *  is used as many times as it's in the rack, and a blank ('?') stands for any letter.
+ *  The query is a single walk of the key trie, which visits only the keys made of the rack
+ *  letters, so it doesn't depend on the size of the dictionary. The trie is shared by all
+ *  the copies of the index, and any number of queries may run concurrently:
+ *
+ *  RackSearch racks(index);
+ *  QVector<DictionaryIndex::Group> groups = racks.find("lowe?");
+ */
+class RackSearch
+{
+public:
+    explicit RackSearch(const DictionaryIndex &index);
+
+    /*
+     *  The groups of the words made of the letters of the rack, not shorter than 'minLength'.
+     *  The longest groups go first, the groups of the same length are sorted by their keys
+     */
+    QVector<DictionaryIndex::Group> find(const QString &rack, int minLength = 1) const;
+
+private:
+    DictionaryIndex m_index;
+};
+
+#endif // RACKSEARCH_H
@@ -0,0 +1,341 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "referencesearch.h"
+
+ReferenceSearch::ReferenceSearch(const Anagrams &anagrams)
+{
+    for(auto it = anagrams.constBegin();it != anagrams.constEnd();++it)
+    {
+        for(const std::string &word : it.value())
+            m_groups[sorted(word)].insert(word);
+    }
+}
+
+int ReferenceSearch::find(const QString &word, std::set<std::string> *lastWords) const
+{
+    const std::string excluded = m_constraints.excluded();
+    const std::string required = m_constraints.required();
+
+    std::string letters = sorted(word.toLower().toStdString());
+    const std::size_t blanks = std::count(letters.begin(), letters.end(), '?');
+    letters.erase(0, blanks);
+
+    const int maxStep = std::max(1, m_constraints.maxStep);
+
+    std::set<std::string> level = { letters };
+    std::set<std::string> lastLevel;
+    int steps = 0;
+    int lastSteps = 0;
+
+    while(true)
+    {
+        std::set<std::string> nextLevel;
+
+        // every blank is any allowed letter, so the first level is all
+        // the keys containing the letters and the blanks plus the letters of a step
+        if(!steps && blanks)
+            supersets(letters, blanks + 1, blanks + maxStep, excluded, &nextLevel);
+        else if(maxStep > 1)
+        {
+            for(const std::string &key : level)
+                supersets(key, 1, maxStep, excluded, &nextLevel);
+        }
+        else
+        {
+            for(const std::string &key : level)
+            {
+                if(m_constraints.maxLength > 0 && static_cast<int>(key.length()) >= m_constraints.maxLength)
+                    continue;
+
+                for(char letter = 'a';letter <= 'z';letter++)
+                {
+                    if(excluded.find(letter) != std::string::npos)
+                        continue;
+
+                    const std::string nextKey = sorted(key + letter);
+
+                    if(m_groups.count(nextKey))
+                        nextLevel.insert(nextKey);
+                }
+            }
+        }
+
+        if(nextLevel.empty())
+            break;
+
+        level.swap(nextLevel);
+        steps++;
+
+        // the keys the longest chains may end with
+        std::set<std::string> accepted;
+
+        for(const std::string &key : level)
+        {
+            if(std::includes(key.begin(), key.end(), required.begin(), required.end()))
+                accepted.insert(key);
+        }
+
+        if(!accepted.empty())
+        {
+            lastLevel.swap(accepted);
+            lastSteps = steps;
+        }
+    }
+
+    if(lastWords)
+    {
+        lastWords->clear();
+
+        for(const std::string &key : lastLevel)
+        {
+            const std::set<std::string> &words = m_groups.at(key);
+            lastWords->insert(words.begin(), words.end());
+        }
+    }
+
+    return lastSteps;
+}
+
+int ReferenceSearch::findSeeds(const QString &target, std::set<std::string> *seeds) const
+{
+    const std::string targetKey = sorted(target.toLower().toStdString());
+
+    // the keys made of the letters of the target, the longest ones first
+    std::vector<std::string> keys;
+
+    for(const auto &group : m_groups)
+    {
+        if(group.first.length() < targetKey.length()
+                && std::includes(targetKey.begin(), targetKey.end(), group.first.begin(), group.first.end()))
+            keys.push_back(group.first);
+    }
+
+    std::stable_sort(keys.begin(), keys.end(), [](const std::string &a, const std::string &b) {
+        return a.length() > b.length();
+    });
+
+    // a key is an ancestor if the target or another ancestor is the key plus one letter
+    std::set<std::string> ancestors;
+    std::size_t shortest = targetKey.length();
+
+    for(const std::string &key : keys)
+    {
+        bool ancestor = key.length() + 1 == targetKey.length();
+
+        for(auto it = ancestors.begin();!ancestor && it != ancestors.end();++it)
+            ancestor = it->length() == key.length() + 1 && std::includes(it->begin(), it->end(), key.begin(), key.end());
+
+        if(ancestor)
+        {
+            ancestors.insert(key);
+            shortest = std::min(shortest, key.length());
+        }
+    }
+
+    if(seeds)
+    {
+        seeds->clear();
+
+        for(const std::string &key : ancestors)
+        {
+            if(key.length() == shortest)
+            {
+                const std::set<std::string> &words = m_groups.at(key);
+                seeds->insert(words.begin(), words.end());
+            }
+        }
+    }
+
+    return static_cast<int>(targetKey.length() - shortest);
+}
+
+int ReferenceSearch::findLadder(const QString &from, const QString &to, bool allowRemovals, qint64 *chains) const
+{
+    const std::string fromKey = sorted(from.toLower().toStdString());
+    const std::string toKey = sorted(to.toLower().toStdString());
+
+    // all the keys the chains may go through
+    std::set<std::string> keys = { toKey };
+
+    for(const auto &group : m_groups)
+        keys.insert(group.first);
+
+    // breadth-first search counting the shortest routes to every key
+    std::map<std::string, int> distances = { { fromKey, 0 } };
+    std::map<std::string, qint64> routes = { { fromKey, 1 } };
+    std::vector<std::string> level = { fromKey };
+
+    while(!level.empty() && !distances.count(toKey))
+    {
+        std::vector<std::string> nextLevel;
+
+        for(const std::string &key : level)
+        {
+            for(const std::string &next : keys)
+            {
+                const bool added = next.length() == key.length() + 1
+                                    && std::includes(next.begin(), next.end(), key.begin(), key.end());
+                const bool removed = allowRemovals
+                                    && next.length() + 1 == key.length()
+                                    && std::includes(key.begin(), key.end(), next.begin(), next.end());
+
+                if(!added && !removed)
+                    continue;
+
+                auto it = distances.find(next);
+
+                if(it == distances.end())
+                {
+                    distances[next] = distances[key] + 1;
+                    routes[next] = routes[key];
+                    nextLevel.push_back(next);
+                }
+                else if(it->second == distances[key] + 1)
+                    routes[next] += routes[key];
+            }
+        }
+
+        level.swap(nextLevel);
+    }
+
+    if(chains)
+        *chains = distances.count(toKey) ? routes[toKey] : 0;
+
+    return distances.count(toKey) ? distances[toKey] : -1;
+}
+
+int ReferenceSearch::findRackWords(const QString &rack, std::set<std::string> *words) const
+{
+    std::string letters = sorted(rack.toLower().toStdString());
+    const std::size_t blanks = std::count(letters.begin(), letters.end(), '?');
+    letters.erase(0, blanks);
+
+    std::set<std::string> result;
+
+    for(const auto &group : m_groups)
+    {
+        // the letters of the key missing in the rack are the blanks
+        std::string missing;
+        std::set_difference(group.first.begin(), group.first.end(), letters.begin(), letters.end(), std::back_inserter(missing));
+
+        if(missing.length() <= blanks)
+            result.insert(group.second.begin(), group.second.end());
+    }
+
+    const int count = static_cast<int>(result.size());
+
+    if(words)
+        words->swap(result);
+
+    return count;
+}
+
+void ReferenceSearch::setConstraints(const SearchConstraints &constraints)
+{
+    m_constraints = constraints;
+}
+
+bool ReferenceSearch::isValidChain(const QString &word, const LongestPath &chain, QString *error) const
+{
+    std::string previous = sorted(word.toLower().toStdString());
+    std::size_t blanks = std::count(previous.begin(), previous.end(), '?');
+    previous.erase(0, blanks);
+
+    for(int i = 0;i < chain.size();i++)
+    {
+        const std::string &current = chain[i];
+        const std::string key = sorted(current);
+        auto it = m_groups.find(key);
+
+        if(it == m_groups.end() || !it->second.count(current))
+        {
+            if(error)
+                *error = QString("\"%1\" is not in the dictionary").arg(QString::fromStdString(current));
+
+            return false;
+        }
+
+        // the previous key must be the current key without the letters of one step,
+        // and without the blanks of the starting word
+        const std::size_t maxStep = std::max(1, m_constraints.maxStep);
+        const bool derived = key.length() > previous.length() + blanks
+                                && key.length() <= previous.length() + blanks + maxStep
+                                && std::includes(key.begin(), key.end(), previous.begin(), previous.end());
+
+        if(!derived)
+        {
+            if(error)
+                *error = QString("\"%1\" is not derived from the previous word").arg(QString::fromStdString(current));
+
+            return false;
+        }
+
+        previous = key;
+        blanks = 0;
+    }
+
+    return true;
+}
+
+bool ReferenceSearch::allowedExtraLetters(const std::string &key, const std::string &letters, const std::string &excluded)
+{
+    std::string extra;
+    std::set_difference(key.begin(), key.end(), letters.begin(), letters.end(), std::back_inserter(extra));
+
+    for(const char letter : extra)
+    {
+        if(excluded.find(letter) != std::string::npos)
+            return false;
+    }
+
+    return true;
+}
+
+void ReferenceSearch::supersets(const std::string &letters, int minExtra, int maxExtra, const std::string &excluded, std::set<std::string> *keys) const
+{
+    for(const auto &group : m_groups)
+    {
+        const std::string &key = group.first;
+        const int extra = static_cast<int>(key.length()) - static_cast<int>(letters.length());
+
+        if(extra >= minExtra && extra <= maxExtra
+                && (m_constraints.maxLength <= 0 || static_cast<int>(key.length()) <= m_constraints.maxLength)
+                && std::includes(key.begin(), key.end(), letters.begin(), letters.end())
+                && allowedExtraLetters(key, letters, excluded))
+            keys->insert(key);
+    }
+}
+
+std::string ReferenceSearch::sorted(const std::string &word)
+{
+    std::string result = word;
+    std::sort(result.begin(), result.end());
+    return result;
+}
@@ -0,0 +1,113 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef REFERENCESEARCH_H
+#define REFERENCESEARCH_H
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "anagrams.h"
+#include "longestpaths.h"
+#include "searchconstraints.h"
+
+/*
+ *  Slow and obviously correct search used as an oracle for the optimized searches.
+ *  It doesn't share any code with them: no index, no pruning, no caches. Starting with
+ *  the sorted word, it builds every level of reachable keys (the previous level with
+ *  one more letter) until the next level is empty. The words of the last level are
+ *  exactly the words the longest chains may end with. The blanks of the starting word
+ *  and the steps adding more than one letter are handled by checking every key
+ *  of the dictionary
+ */
+class ReferenceSearch
+{
+public:
+    explicit ReferenceSearch(const Anagrams &anagrams);
+
+    /*
+     *  Number of steps in the longest chains, 0 if no chains exist. The possible last
+     *  words of the longest chains are saved into 'lastWords' if it's not null
+     */
+    int find(const QString &word, std::set<std::string> *lastWords = nullptr) const;
+
+    /*
+     *  Number of steps from the shortest words the target is derived from, 0 if there are
+     *  no such words. The shortest words are saved into 'seeds' if it's not null. The
+     *  constraints are not applied
+     */
+    int findSeeds(const QString &target, std::set<std::string> *seeds = nullptr) const;
+
+    /*
+     *  Number of steps in the shortest chains from the first word to the last one, -1 if there
+     *  are no chains. Every step adds a letter, or also removes one if 'allowRemovals' is true.
+     *  The number of the shortest chains is saved into 'chains' if it's not null
+     */
+    int findLadder(const QString &from, const QString &to, bool allowRemovals, qint64 *chains = nullptr) const;
+
+    /*
+     *  The words made of the letters of the rack. Every letter is used as many times as it's
+     *  in the rack, and every blank stands for any letter. Returns the number of the words
+     */
+    int findRackWords(const QString &rack, std::set<std::string> *words = nullptr) const;
+
+    /*
+     *  Constraints of the next searches. The levels are built without the excluded
+     *  letters and the words longer than the maximum length, and the longest chains
+     *  end at the last level with the keys containing the required letters
+     */
+    void setConstraints(const SearchConstraints &constraints);
+
+    /*
+     *  Check that every word of the chain is in the dictionary and is derived from the
+     *  previous word by adding a single letter, or up to the maximum step of the constraints.
+     *  The starting word is not included in the chain
+     */
+    bool isValidChain(const QString &word, const LongestPath &chain, QString *error = nullptr) const;
+
+private:
+    static
+    std::string sorted(const std::string &word);
+
+    /*
+     *  The letters of the key that are not in 'letters' are not excluded
+     */
+    static
+    bool allowedExtraLetters(const std::string &key, const std::string &letters, const std::string &excluded);
+
+    /*
+     *  Insert into 'keys' every key of the dictionary containing the letters plus
+     *  from 'minExtra' to 'maxExtra' allowed letters
+     */
+    void supersets(const std::string &letters, int minExtra, int maxExtra, const std::string &excluded, std::set<std::string> *keys) const;
+
+private:
+    // sorted key -> unique words
+    std::map<std::string, std::set<std::string>> m_groups;
+    SearchConstraints m_constraints;
+};
+
+#endif // REFERENCESEARCH_H
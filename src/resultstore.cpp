@@ -0,0 +1,235 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "resultstore.h"
+#include "tracer.h"
+
+// bump the version when the record format changes
+static constexpr const char *STORE_MAGIC = "ANAGRAMS-RESULTS";
+static constexpr quint32 STORE_VERSION = 1;
+
+ResultStore::ResultStore(const QString &dictionaryPath, const QByteArray &fingerprint)
+    : m_path(storePath(dictionaryPath))
+    , m_fingerprint(fingerprint)
+    , m_validSize(0)
+{
+    load();
+}
+
+std::string ResultStore::keyForWord(const QString &word)
+{
+    std::string key = word.toLower().toStdString();
+    std::sort(key.begin(), key.end());
+    return key;
+}
+
+QString ResultStore::storePath(const QString &dictionaryPath)
+{
+    return dictionaryPath + ".results";
+}
+
+bool ResultStore::find(const std::string &key, LongestPaths *paths) const
+{
+    auto it = m_results.constFind(key);
+
+    if(it == m_results.constEnd())
+        return false;
+
+    if(paths)
+        *paths = it.value();
+
+    return true;
+}
+
+bool ResultStore::append(const std::string &key, const LongestPaths &paths)
+{
+    TraceSpan span("result-store-append");
+
+    QByteArray payload;
+
+    {
+        QDataStream stream(&payload, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_5_0);
+
+        stream << QByteArray(key.c_str(), static_cast<int>(key.length()))
+               << static_cast<quint32>(paths.size());
+
+        for(const LongestPath &path : paths)
+        {
+            stream << static_cast<quint32>(path.size());
+
+            for(const std::string &word : path)
+                stream << QByteArray(word.c_str(), static_cast<int>(word.length()));
+        }
+    }
+
+    QFile file(m_path);
+
+    if(!file.open(QFile::ReadWrite))
+    {
+        qWarning("Cannot open the result store %s: %s", qPrintable(m_path), qPrintable(file.errorString()));
+        return false;
+    }
+
+    // start from scratch if the store is missing or doesn't match the dictionary, otherwise
+    // cut off the damaged tail if any
+    if(m_validSize == 0)
+    {
+        if(!file.resize(0) || !writeHeader(&file))
+        {
+            qWarning("Cannot initialize the result store %s", qPrintable(m_path));
+            return false;
+        }
+    }
+    else if(!file.resize(m_validSize) || !file.seek(m_validSize))
+    {
+        qWarning("Cannot truncate the result store %s", qPrintable(m_path));
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << static_cast<quint32>(payload.size()) << checksum(payload);
+
+    if(stream.writeRawData(payload.constData(), payload.size()) != payload.size()
+            || stream.status() != QDataStream::Ok)
+    {
+        qWarning("Cannot write into the result store %s", qPrintable(m_path));
+        return false;
+    }
+
+    m_validSize = file.pos();
+    m_results.insert(key, paths);
+
+    return true;
+}
+
+void ResultStore::load()
+{
+    TraceSpan span("result-store-load");
+
+    QFile file(m_path);
+
+    if(!file.exists())
+        return;
+
+    if(!file.open(QFile::ReadOnly))
+    {
+        qWarning("Cannot open the result store %s: %s", qPrintable(m_path), qPrintable(file.errorString()));
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    QByteArray magic, fingerprint;
+    quint32 version = 0;
+
+    stream >> magic >> version >> fingerprint;
+
+    // the store belongs to another dictionary or to another version of the app
+    if(stream.status() != QDataStream::Ok
+            || magic != STORE_MAGIC
+            || version != STORE_VERSION
+            || fingerprint != m_fingerprint)
+    {
+        qDebug("The result store %s doesn't match the dictionary, ignoring it", qPrintable(m_path));
+        return;
+    }
+
+    m_validSize = file.pos();
+
+    while(!stream.atEnd())
+    {
+        quint32 size = 0;
+        QByteArray sum;
+
+        stream >> size >> sum;
+
+        if(stream.status() != QDataStream::Ok || size > file.size() - file.pos())
+            break;
+
+        const QByteArray payload = file.read(size);
+
+        if(static_cast<quint32>(payload.size()) != size || checksum(payload) != sum)
+            break;
+
+        QDataStream payloadStream(payload);
+        payloadStream.setVersion(QDataStream::Qt_5_0);
+
+        QByteArray key;
+        quint32 pathsCount = 0;
+        LongestPaths paths;
+
+        payloadStream >> key >> pathsCount;
+
+        for(quint32 i = 0;i < pathsCount && payloadStream.status() == QDataStream::Ok;i++)
+        {
+            quint32 wordsCount = 0;
+            LongestPath path;
+
+            payloadStream >> wordsCount;
+
+            for(quint32 j = 0;j < wordsCount && payloadStream.status() == QDataStream::Ok;j++)
+            {
+                QByteArray word;
+                payloadStream >> word;
+                path.push(std::string(word.constData(), word.size()));
+            }
+
+            paths.append(path);
+        }
+
+        // the checksum has matched but the payload is still broken
+        if(payloadStream.status() != QDataStream::Ok)
+            break;
+
+        m_results.insert(std::string(key.constData(), key.size()), paths);
+        m_validSize = file.pos();
+    }
+
+    if(m_validSize != file.size())
+        qWarning("The result store %s is damaged, ignoring its tail", qPrintable(m_path));
+
+    qDebug("Result store has been loaded. Size: %d", m_results.size());
+}
+
+bool ResultStore::writeHeader(QIODevice *device) const
+{
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << QByteArray(STORE_MAGIC) << STORE_VERSION << m_fingerprint;
+
+    return stream.status() == QDataStream::Ok;
+}
+
+QByteArray ResultStore::checksum(const QByteArray &payload)
+{
+    return QCryptographicHash::hash(payload, QCryptographicHash::Md5);
+}
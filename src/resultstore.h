@@ -0,0 +1,103 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef RESULTSTORE_H
+#define RESULTSTORE_H
+
+#include "anagrams.h"
+#include "longestpaths.h"
+
+#include <string>
+
+/*
+ *  Append-only on-disk store of search results. The store lives next to the dictionary
+ *  ("words.txt" -> "words.txt.results") and maps a sorted starting word to the chains
+ *  found for it. The results never change for the same dictionary, so they are computed
+ *  once and served instantly in the next sessions.
+ *
+ *  File format:
+ *
+ *  header: magic, version, dictionary fingerprint
+ *  record: payload size, payload checksum, payload (sorted word + chains)
+ *  record: ...
+ *
+ *  A store with a different fingerprint (the dictionary has been changed) is ignored
+ *  and rewritten with the next append. A damaged record (e.g. the app has been killed
+ *  in the middle of writing) is ignored together with the rest of the file
+ */
+class ResultStore
+{
+public:
+    ResultStore(const QString &dictionaryPath, const QByteArray &fingerprint);
+
+    /*
+     *  Sort the word by characters, this is the key of the store
+     */
+    static
+    std::string keyForWord(const QString &word);
+
+    /*
+     *  Path to the store of the specified dictionary
+     */
+    static
+    QString storePath(const QString &dictionaryPath);
+
+    /*
+     *  Find the cached result. Returns false if there is no such result
+     */
+    bool find(const std::string &key, LongestPaths *paths) const;
+
+    /*
+     *  Save the result into the store. Returns false on I/O errors
+     */
+    bool append(const std::string &key, const LongestPaths &paths);
+
+    /*
+     *  Number of cached results
+     */
+    inline
+    int size() const;
+
+private:
+    void load();
+    bool writeHeader(QIODevice *device) const;
+
+    static
+    QByteArray checksum(const QByteArray &payload);
+
+private:
+    QString m_path;
+    QByteArray m_fingerprint;
+    QHash<std::string, LongestPaths> m_results;
+    // size of the valid part of the file. The rest gets truncated with the next append
+    qint64 m_validSize;
+};
+
+int ResultStore::size() const
+{
+    return m_results.size();
+}
+
+#endif // RESULTSTORE_H
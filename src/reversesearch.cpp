@@ -0,0 +1,156 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include "reversesearch.h"
+#include "sortedkey.h"
+#include "tracer.h"
+
+namespace
+{
+
+/*
+ *  A key of a level and the node of the previous level it has been found from,
+ *  or -1 if it has been found from the target
+ */
+struct Node
+{
+    DictionaryIndex::Group group;
+    int parent;
+};
+
+}
+
+ReverseSearch::ReverseSearch(const DictionaryIndex &index)
+    : m_index(index)
+{}
+
+LongestPaths ReverseSearch::find(const QString &target, SearchStatistics *statistics) const
+{
+    TraceSpan span("reverse-search", [&target] { return target; });
+
+    const std::string word = target.toLower().toStdString();
+    std::string sortedWord = word;
+    std::sort(sortedWord.begin(), sortedWord.end());
+
+    // the nodes of all the levels one after another. The target is the first level, but not a node
+    std::vector<Node> nodes;
+    std::unordered_set<const char *> visited;
+    std::vector<char> key(sortedWord.length());
+    QVector<DepthStatistics> depths;
+    std::size_t levelBegin = 0;
+    std::size_t levelEnd = 0;
+    int length = static_cast<int>(sortedWord.length());
+
+    for(int depth = 0;length > 1;depth++, length--)
+    {
+        DepthStatistics counters;
+        const std::size_t count = depth ? levelEnd - levelBegin : 1;
+
+        for(std::size_t i = 0;i < count;i++)
+        {
+            // keys point into the index, so they stay valid when the nodes grow
+            const char *current = depth ? nodes[levelBegin + i].group.key() : sortedWord.c_str();
+            const int parent = depth ? static_cast<int>(levelBegin + i) : -1;
+
+            counters.nodes++;
+
+            for(int position = 0;position < length;position++)
+            {
+                // removing any of the repeated letters gives the same key
+                if(position > 0 && current[position] == current[position - 1])
+                    continue;
+
+                removeFromSortedKey(current, length, position, key.data());
+
+                const DictionaryIndex::Group group = m_index.group(key.data(), length - 1);
+
+                counters.probes++;
+
+                if(group.isEmpty())
+                    continue;
+
+                counters.hits++;
+
+                // already found from another key of this level
+                if(visited.insert(group.key()).second)
+                    nodes.push_back({ group, parent });
+                else
+                    counters.skipped++;
+            }
+        }
+
+        depths.append(counters);
+
+        // nothing is shorter, the current level is the last one
+        if(nodes.size() == levelEnd)
+            break;
+
+        levelBegin = levelEnd;
+        levelEnd = nodes.size();
+    }
+
+    LongestPaths result;
+
+    for(std::size_t i = levelBegin;i < levelEnd;i++)
+    {
+        const DictionaryIndex::Group &seed = nodes[i].group;
+        LongestPath tail;
+
+        // the first word of every group, like the chains of AnagramSearch
+        for(int parent = nodes[i].parent;parent >= 0;parent = nodes[parent].parent)
+            tail.push(nodes[parent].group.wordString(0));
+
+        tail.push(word);
+
+        for(int j = 0;j < seed.size();j++)
+        {
+            LongestPath chain;
+            chain.reserve(tail.size() + 1);
+            chain.push(seed.wordString(j));
+
+            for(const std::string &str : tail)
+                chain.push(str);
+
+            result.append(chain);
+        }
+    }
+
+    if(statistics)
+    {
+        *statistics = SearchStatistics();
+        statistics->depths = depths;
+        statistics->memory.add("levels", static_cast<qint64>(nodes.capacity() * sizeof(Node)), static_cast<qint64>(nodes.size()));
+        statistics->memory.add("visited keys", static_cast<qint64>(visited.bucket_count() * sizeof(void *)
+                                                                   + visited.size() * (sizeof(void *) + sizeof(const char *))),
+                               static_cast<qint64>(visited.size()));
+        statistics->memory.add("results: ", MemoryUsage::ofPaths(result));
+    }
+
+    return result;
+}
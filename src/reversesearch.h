@@ -0,0 +1,63 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef REVERSESEARCH_H
+#define REVERSESEARCH_H
+
+#include "dictionaryindex.h"
+#include "longestpaths.h"
+#include "searchstatistics.h"
+
+/*
+ *  Reverse derivation: the shortest words the target is derived from. Starting with
+ *  the sorted target, every level is the keys of the previous level without one letter,
+ *  until no key can be shortened anymore. The predecessors of a key are found by probing
+ *  the index with the key without every distinct letter, so they are never stored, and
+ *  the work is proportional to the ancestry of the target, not to the size of the dictionary.
+ *  Every key is walked once, at the first level it's found at
+ */
+class ReverseSearch
+{
+public:
+    explicit ReverseSearch(const DictionaryIndex &index);
+
+    /*
+     *  Find the shortest words the target is derived from, and a chain from every such word
+     *  to the target. Unlike AnagramSearch, the chains start with the found word and end
+     *  with the target, which doesn't have to be in the dictionary:
+     *
+     *  art -> rats -> ... -> orchestra
+     *  rat -> rats -> ... -> orchestra
+     *
+     *  The counters of the search are saved into 'statistics' if it's not null. The depth
+     *  is the number of letters removed from the target
+     */
+    LongestPaths find(const QString &target, SearchStatistics *statistics = nullptr) const;
+
+private:
+    DictionaryIndex m_index;
+};
+
+#endif // REVERSESEARCH_H
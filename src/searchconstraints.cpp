@@ -0,0 +1,116 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "searchconstraints.h"
+#include "sortedkey.h"
+
+namespace
+{
+
+std::string normalizedLetters(const QString &letters)
+{
+    std::string result;
+
+    for(const char letter : letters.toLower().toLatin1())
+    {
+        if(letter && std::strchr(alphabet, letter))
+            result += letter;
+    }
+
+    std::sort(result.begin(), result.end());
+
+    return result;
+}
+
+}
+
+bool SearchConstraints::isEmpty() const
+{
+    return excluded().empty() && required().empty() && maxLength <= 0 && maxStep <= 1;
+}
+
+std::string SearchConstraints::excluded() const
+{
+    std::string result = normalizedLetters(excludedLetters);
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::string SearchConstraints::required() const
+{
+    return normalizedLetters(requiredLetters);
+}
+
+QString SearchConstraints::toString() const
+{
+    QStringList result;
+
+    if(!excluded().empty())
+        result.append(QString("without '%1'").arg(QString::fromStdString(excluded())));
+
+    if(!required().empty())
+        result.append(QString("with '%1'").arg(QString::fromStdString(required())));
+
+    if(maxLength > 0)
+        result.append(QString("up to %1 letters").arg(maxLength));
+
+    if(maxStep > 1)
+        result.append(QString("up to %1 letters per step").arg(maxStep));
+
+    return result.join(", ");
+}
+
+QJsonObject SearchConstraints::toJson() const
+{
+    QJsonObject result;
+
+    if(!excluded().empty())
+        result["exclude"] = QString::fromStdString(excluded());
+
+    if(!required().empty())
+        result["require"] = QString::fromStdString(required());
+
+    if(maxLength > 0)
+        result["max_length"] = maxLength;
+
+    if(maxStep > 1)
+        result["max_step"] = maxStep;
+
+    return result;
+}
+
+SearchConstraints SearchConstraints::fromJson(const QJsonObject &object)
+{
+    SearchConstraints result;
+
+    result.excludedLetters = object.value("exclude").toString();
+    result.requiredLetters = object.value("require").toString();
+    result.maxLength = object.value("max_length").toInt();
+    result.maxStep = object.value("max_step").toInt(1);
+
+    return result;
+}
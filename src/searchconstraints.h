@@ -0,0 +1,79 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SEARCHCONSTRAINTS_H
+#define SEARCHCONSTRAINTS_H
+
+#include <QtCore>
+
+#include <string>
+
+/*
+ *  Constraints of a search. The search prunes the letters and the depths that cannot
+ *  satisfy them, so a constrained search is faster than an unconstrained one:
+ *
+ *  - the excluded letters are never added to a word of the chain
+ *  - the last word of the chain must contain the required letters (with repetitions),
+ *    which also means that the chain passes through a word containing them
+ *  - the words of the chain are not longer than the maximum length
+ *
+ *  The maximum step relaxes the derivation rule instead: every step adds from one up to
+ *  that many letters, and the longest chains are the chains with the most steps
+ */
+struct SearchConstraints
+{
+    SearchConstraints()
+        : maxLength(0)
+        , maxStep(1)
+    {}
+
+    bool isEmpty() const;
+
+    /*
+     *  Sorted lower case letters, without the letters outside of a-z. The excluded
+     *  letters are also unique
+     */
+    std::string excluded() const;
+    std::string required() const;
+
+    /*
+     *  Human readable description like "without 'q', with 'z', up to 12 letters"
+     */
+    QString toString() const;
+
+    QJsonObject toJson() const;
+
+    static
+    SearchConstraints fromJson(const QJsonObject &object);
+
+    QString excludedLetters;
+    QString requiredLetters;
+    // 0 means no limit
+    int maxLength;
+    // letters added per step, 1 is the classic derivation
+    int maxStep;
+};
+
+#endif // SEARCHCONSTRAINTS_H
@@ -0,0 +1,126 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "anagramsearch.h"
+#include "searchpool.h"
+#include "settings.h"
+
+namespace
+{
+
+/*
+ *  A single query executed by one of the workers
+ */
+class SearchTask : public QRunnable
+{
+public:
+    SearchTask(const DictionaryIndex &index,
+               const QString &word,
+               bool profile,
+               const QSharedPointer<ChainStream> &stream,
+               const SearchConstraints &constraints)
+        : m_index(index)
+        , m_word(word)
+        , m_profile(profile)
+        , m_stream(stream)
+        , m_constraints(constraints)
+    {
+        m_interface.reportStarted();
+    }
+
+    QFuture<QueryResult> future()
+    {
+        return m_interface.future();
+    }
+
+    virtual void run() override
+    {
+        QueryResult result;
+
+        if(!m_interface.isCanceled())
+        {
+            QElapsedTimer algorithmTimeCounter;
+            algorithmTimeCounter.start();
+
+            AnagramSearch search(m_index);
+            search.setCancelCheck([this]() { return m_interface.isCanceled(); });
+            search.setConstraints(m_constraints);
+
+            result.longestPaths = search.find(m_word, &result.statistics, m_profile ? &result.profile : nullptr, m_stream.data());
+            result.canceled = search.isCanceled();
+
+            result.algorithmTime = algorithmTimeCounter.elapsed();
+        }
+        else
+            result.canceled = true;
+
+        m_interface.reportResult(result);
+        m_interface.reportFinished();
+    }
+
+private:
+    DictionaryIndex m_index;
+    QString m_word;
+    bool m_profile;
+    QSharedPointer<ChainStream> m_stream;
+    SearchConstraints m_constraints;
+    QFutureInterface<QueryResult> m_interface;
+};
+
+}
+
+SearchPool *SearchPool::instance()
+{
+    static SearchPool *inst = new SearchPool;
+    return inst;
+}
+
+SearchPool::SearchPool()
+{
+    // the workers are never destroyed in the middle of the session
+    m_pool.setExpiryTimeout(-1);
+
+    setMaxThreadCount(SETTINGS_GET_INT(SETTING_SEARCH_THREADS));
+}
+
+QFuture<QueryResult> SearchPool::submit(const DictionaryIndex &index,
+                                        const QString &word,
+                                        bool profile,
+                                        const QSharedPointer<ChainStream> &stream,
+                                        const SearchConstraints &constraints)
+{
+    SearchTask *task = new SearchTask(index, word, profile, stream, constraints);
+    QFuture<QueryResult> future = task->future();
+
+    // the pool takes the ownership of the task
+    m_pool.start(task);
+
+    return future;
+}
+
+void SearchPool::setMaxThreadCount(int count)
+{
+    m_pool.setMaxThreadCount(count > 0 ? count : QThread::idealThreadCount());
+}
@@ -0,0 +1,123 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SEARCHPOOL_H
+#define SEARCHPOOL_H
+
+#include "dictionaryindex.h"
+#include "chainstream.h"
+#include "searchconstraints.h"
+#include "longestpaths.h"
+#include "searchstatistics.h"
+#include "searchprofile.h"
+
+/*
+ *  Result of a single query
+ */
+struct QueryResult
+{
+    QueryResult()
+        : algorithmTime(0)
+        , canceled(false)
+    {}
+
+    /*
+     *  Result as a list of chains like that:
+     *
+     *  owl -> lowe -> ...
+     *  owl -> awol -> ...
+     *
+     *  Later we load them into SearchResults
+     */
+    LongestPaths longestPaths;
+
+    // time to compute the whole algorihtm. We display this valus in the main UI
+    qint64 algorithmTime;
+
+    // counters of the search
+    SearchStatistics statistics;
+
+    // empty if the search has not been profiled
+    SearchProfile profile;
+
+    // the future has been canceled, the result is empty
+    bool canceled;
+};
+
+/*
+ *  Persistent pool of search workers shared by the whole application. Queries are submitted
+ *  as tasks and their results are delivered through futures, so no thread is created or
+ *  destroyed per query
+ */
+class SearchPool
+{
+public:
+    static
+    SearchPool *instance();
+
+    /*
+     *  Queue the query. The future is finished when the result is ready.
+     *  A profiled query is slower. The chains are appended to 'stream' while
+     *  the query is running if it's not null. Canceling the future stops
+     *  the query even if it is already running
+     */
+    QFuture<QueryResult> submit(const DictionaryIndex &index,
+                                const QString &word,
+                                bool profile = false,
+                                const QSharedPointer<ChainStream> &stream = QSharedPointer<ChainStream>(),
+                                const SearchConstraints &constraints = SearchConstraints());
+
+    /*
+     *  Maximum number of workers. 0 means the number of CPU cores
+     */
+    void setMaxThreadCount(int count);
+
+    inline
+    int maxThreadCount() const;
+
+    /*
+     *  Block until all the queued queries are finished
+     */
+    inline
+    void waitForDone();
+
+private:
+    SearchPool();
+
+private:
+    QThreadPool m_pool;
+};
+
+int SearchPool::maxThreadCount() const
+{
+    return m_pool.maxThreadCount();
+}
+
+void SearchPool::waitForDone()
+{
+    m_pool.waitForDone();
+}
+
+#endif // SEARCHPOOL_H
@@ -0,0 +1,130 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "searchprofile.h"
+
+namespace
+{
+
+QJsonArray keysToJson(const QVector<SearchProfile::Key> &keys)
+{
+    QJsonArray array;
+
+    for(const SearchProfile::Key &key : keys)
+    {
+        QJsonObject object;
+
+        object["key"] = QString::fromStdString(key.key);
+        object["expansions"] = static_cast<double>(key.expansions);
+        object["total_ms"] = key.totalNs / 1e6;
+
+        array.append(object);
+    }
+
+    return array;
+}
+
+QString keysToString(const QVector<SearchProfile::Key> &keys, qint64 totalNs)
+{
+    QString result = QString("key").leftJustified(24)
+                     + QString("expansions").rightJustified(12)
+                     + QString("total, ms").rightJustified(12)
+                     + QString("share").rightJustified(8)
+                     + '\n';
+
+    for(const SearchProfile::Key &key : keys)
+    {
+        result += QString::fromStdString(key.key).leftJustified(24)
+                  + QString::number(key.expansions).rightJustified(12)
+                  + QString::number(key.totalNs / 1e6, 'f', 3).rightJustified(12)
+                  + QString("%1%").arg(totalNs ? key.totalNs * 100.0 / totalNs : 0, 0, 'f', 1).rightJustified(8)
+                  + '\n';
+    }
+
+    return result;
+}
+
+}
+
+QJsonObject SearchProfile::toJson() const
+{
+    QJsonObject object;
+
+    object["total_ms"] = totalNs / 1e6;
+    object["distinct_keys"] = static_cast<double>(distinctKeys);
+    object["repeated_expansions"] = static_cast<double>(repeatedExpansions);
+    object["repeated_ms"] = repeatedNs / 1e6;
+
+    QJsonArray perDepth;
+
+    for(int i = 0;i < depths.size();i++)
+    {
+        QJsonObject depth;
+
+        depth["depth"] = i;
+        depth["nodes"] = static_cast<double>(depths[i].nodes);
+        depth["self_ms"] = depths[i].selfNs / 1e6;
+        depth["total_ms"] = depths[i].totalNs / 1e6;
+
+        perDepth.append(depth);
+    }
+
+    object["depths"] = perDepth;
+    object["keys_by_time"] = keysToJson(keysByTime);
+    object["keys_by_expansions"] = keysToJson(keysByExpansions);
+
+    return object;
+}
+
+QString SearchProfile::toString() const
+{
+    QString result = QString("Total: %1ms, distinct keys: %2, repeated expansions: %3, "
+                             "time of the repeated expansions: %4ms (%5%, upper bound of the memoization gain)\n\n")
+                        .arg(totalNs / 1e6, 0, 'f', 3)
+                        .arg(distinctKeys)
+                        .arg(repeatedExpansions)
+                        .arg(repeatedNs / 1e6, 0, 'f', 3)
+                        .arg(totalNs ? repeatedNs * 100.0 / totalNs : 0, 0, 'f', 1);
+
+    result += QString("depth").leftJustified(8)
+              + QString("nodes").rightJustified(12)
+              + QString("self, ms").rightJustified(12)
+              + QString("total, ms").rightJustified(12)
+              + '\n';
+
+    for(int i = 0;i < depths.size();i++)
+    {
+        result += QString::number(i).leftJustified(8)
+                  + QString::number(depths[i].nodes).rightJustified(12)
+                  + QString::number(depths[i].selfNs / 1e6, 'f', 3).rightJustified(12)
+                  + QString::number(depths[i].totalNs / 1e6, 'f', 3).rightJustified(12)
+                  + '\n';
+    }
+
+    result += QString("\nTop %1 keys by time:\n").arg(keysByTime.size()) + keysToString(keysByTime, totalNs);
+    result += QString("\nTop %1 keys by expansions:\n").arg(keysByExpansions.size()) + keysToString(keysByExpansions, totalNs);
+
+    return result;
+}
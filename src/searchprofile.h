@@ -0,0 +1,104 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SEARCHPROFILE_H
+#define SEARCHPROFILE_H
+
+#include <QtCore>
+
+#include <string>
+
+/*
+ *  Opt-in profile of a single search: time and nodes per depth, and the keys which take
+ *  the most time. The same key may be expanded many times through different routes
+ *  (owl + a + b, owl + b + a), and the profile shows how much time memoization of such
+ *  keys would save. Profiling reads the clock twice per expanded word, so it is much
+ *  slower than the counters of SearchStatistics
+ */
+struct SearchProfile
+{
+    struct Depth
+    {
+        Depth()
+            : nodes(0)
+            , selfNs(0)
+            , totalNs(0)
+        {}
+
+        qint64 nodes;
+        // time spent at the depth itself, without the deeper levels
+        qint64 selfNs;
+        // time spent at the depth and below
+        qint64 totalNs;
+    };
+
+    struct Key
+    {
+        std::string key;
+        // times the key has been expanded
+        qint64 expansions;
+        // time spent under the key, all expansions together
+        qint64 totalNs;
+    };
+
+    explicit SearchProfile(int topKeys = 20)
+        : topKeys(topKeys)
+        , totalNs(0)
+        , distinctKeys(0)
+        , repeatedExpansions(0)
+        , repeatedNs(0)
+    {}
+
+    inline
+    bool isEmpty() const;
+
+    QJsonObject toJson() const;
+
+    /*
+     *  Plain text report
+     */
+    QString toString() const;
+
+    // number of keys in the lists below
+    int topKeys;
+    qint64 totalNs;
+    QVector<Depth> depths;
+    QVector<Key> keysByTime;
+    QVector<Key> keysByExpansions;
+    // number of keys expanded at least once
+    qint64 distinctKeys;
+    // expansions of the keys after their first expansion
+    qint64 repeatedExpansions;
+    // time of the repeated expansions. This is the upper bound of what memoization would save,
+    // nested repeated keys are counted more than once
+    qint64 repeatedNs;
+};
+
+bool SearchProfile::isEmpty() const
+{
+    return depths.isEmpty();
+}
+
+#endif // SEARCHPROFILE_H
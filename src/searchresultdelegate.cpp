@@ -0,0 +1,117 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "searchresultdelegate.h"
+#include "searchresultmodel.h"
+
+namespace
+{
+
+// the same gaps as QHBoxLayout of the old per-chain widgets had
+constexpr int MARGIN = 9;
+constexpr int SPACING = 6;
+
+}
+
+SearchResultDelegate::SearchResultDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+{}
+
+void SearchResultDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    QStyleOptionViewItem opt = option;
+    initStyleOption(&opt, index);
+
+    // background and selection only, the text is painted below
+    opt.text.clear();
+
+    QStyle *style = opt.widget ? opt.widget->style() : QApplication::style();
+    style->drawControl(QStyle::CE_ItemViewItem, &opt, painter, opt.widget);
+
+    const QStringList words = index.data(SearchResultModel::WordsRole).toStringList();
+    const QPixmap arrow = arrowPixmap();
+    const QSize arrowSize = arrow.size() / arrow.devicePixelRatio();
+    const QFontMetrics metrics(opt.font);
+
+    painter->save();
+    painter->setFont(opt.font);
+    painter->setPen(opt.palette.color(opt.state & QStyle::State_Selected ? QPalette::HighlightedText : QPalette::Text));
+
+    int x = opt.rect.left() + MARGIN;
+
+    for(int i = 0;i < words.size();i++)
+    {
+        const int width = metrics.horizontalAdvance(words[i]);
+
+        painter->drawText(QRect(x, opt.rect.top(), width, opt.rect.height()), Qt::AlignCenter, words[i]);
+        x += width + SPACING;
+
+        if(i < words.size() - 1)
+        {
+            painter->drawPixmap(QRect(QPoint(x, opt.rect.top() + (opt.rect.height() - arrowSize.height()) / 2), arrowSize), arrow);
+            x += arrowSize.width() + SPACING;
+        }
+    }
+
+    painter->restore();
+}
+
+QSize SearchResultDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    const QStringList words = index.data(SearchResultModel::WordsRole).toStringList();
+    const QSize arrowSize = arrowPixmap().size() / arrowPixmap().devicePixelRatio();
+    const QFontMetrics metrics(option.font);
+
+    // all the chains have the same number of letters, but the letters have different widths.
+    // The view uses the size of the first row for all the rows, so reserve the widest letter
+    int widestLetter = 0;
+
+    for(char letter = 'a';letter <= 'z';letter++)
+        widestLetter = std::max(widestLetter, metrics.horizontalAdvance(QLatin1Char(letter)));
+
+    int width = MARGIN * 2;
+
+    for(const QString &word : words)
+        width += word.length() * widestLetter + SPACING;
+
+    width += std::max(0, words.size() - 1) * (arrowSize.width() + SPACING);
+
+    return QSize(width, std::max(metrics.height(), arrowSize.height()) + SPACING * 2);
+}
+
+QPixmap SearchResultDelegate::arrowPixmap() const
+{
+    constexpr const char *arrowPath = ":/images/arrow.png";
+
+    QPixmap pixmap;
+
+    if(!QPixmapCache::find(arrowPath, &pixmap))
+    {
+        pixmap.load(arrowPath);
+        QPixmapCache::insert(arrowPath, pixmap);
+    }
+
+    return pixmap;
+}
@@ -0,0 +1,96 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "searchresultmodel.h"
+
+SearchResultModel::SearchResultModel(QObject *parent)
+    : QAbstractListModel(parent)
+{}
+
+void SearchResultModel::setResults(const QString &word, const LongestPaths &paths)
+{
+    beginResetModel();
+
+    m_word = word;
+    m_paths = paths;
+
+    endResetModel();
+}
+
+void SearchResultModel::appendResults(const LongestPaths &paths)
+{
+    if(paths.isEmpty())
+        return;
+
+    beginInsertRows(QModelIndex(), m_paths.size(), m_paths.size() + paths.size() - 1);
+    m_paths.append(paths);
+    endInsertRows();
+}
+
+void SearchResultModel::clear()
+{
+    setResults(QString(), LongestPaths());
+}
+
+QStringList SearchResultModel::words(int row) const
+{
+    if(row < 0 || row >= m_paths.size())
+        return QStringList();
+
+    const LongestPath &path = m_paths[row];
+    QStringList result;
+
+    // +1 = starting word that is not included in the chain
+    result.reserve(path.size() + 1);
+    result.append(m_word);
+
+    for(const std::string &str : path)
+        result.append(QString::fromStdString(str));
+
+    return result;
+}
+
+int SearchResultModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_paths.size();
+}
+
+QVariant SearchResultModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid())
+        return QVariant();
+
+    switch(role)
+    {
+        case Qt::DisplayRole:
+            return words(index.row()).join(" -> ");
+
+        case WordsRole:
+            return words(index.row());
+
+        default:
+            return QVariant();
+    }
+}
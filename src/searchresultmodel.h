@@ -0,0 +1,73 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SEARCHRESULTMODEL_H
+#define SEARCHRESULTMODEL_H
+
+#include <QtCore>
+
+#include "longestpaths.h"
+
+/*
+ *  Model of the found chains. The chains are kept as they come from the search,
+ *  and the rows are converted to strings only when the view asks for them
+ */
+class SearchResultModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles
+    {
+        // QStringList of the words of the chain, the starting word is the first one
+        WordsRole = Qt::UserRole + 1
+    };
+
+    explicit SearchResultModel(QObject *parent = nullptr);
+
+    void setResults(const QString &word, const LongestPaths &paths);
+
+    /*
+     *  Append the chains to the end of the list. The chains must have the same length
+     *  as the chains already in the model
+     */
+    void appendResults(const LongestPaths &paths);
+
+    void clear();
+
+    /*
+     *  Words of the chain, the starting word is the first one
+     */
+    QStringList words(int row) const;
+
+    virtual int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    virtual QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    QString m_word;
+    LongestPaths m_paths;
+};
+
+#endif // SEARCHRESULTMODEL_H
@@ -23,85 +23,187 @@
     SOFTWARE.
 */
 
-#include "searchresultlabel.h"
+#include "searchresultdelegate.h"
+#include "searchresultmodel.h"
 #include "searchresults.h"
+#include "tracer.h"
 
 SearchResults::SearchResults(QWidget *parent)
-    : QScrollArea(parent)
+    : QWidget(parent)
 {
+    m_header = new QLabel(this);
+    m_header->hide();
+
+    m_model = new SearchResultModel(this);
+
+    m_view = new QListView(this);
+    m_view->setModel(m_model);
+    m_view->setItemDelegate(new SearchResultDelegate(m_view));
+    m_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_view->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    m_view->setHorizontalScrollMode(QAbstractItemView::ScrollPerPixel);
+
+    // all the chains have the same length, so the view doesn't need
+    // to ask the delegate for the size of every row
+    m_view->setUniformItemSizes(true);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(m_header);
+    layout->addWidget(m_view);
+
+    // the chains of a running search are coalesced and displayed once per frame
+    m_frameTimer.setInterval(16);
+    connect(&m_frameTimer, SIGNAL(timeout()), this, SLOT(slotTakeChains()));
 }
 
-void SearchResults::loadResults(const QString &word, const LongestPaths &paths, qint64 elapsedTime)
+void SearchResults::loadResults(const QString &word,
+                                const LongestPaths &paths,
+                                qint64 elapsedTime,
+                                const SearchStatistics &statistics)
 {
     qDebug("Loading search results");
 
-    clear();
+    TraceSpan span("render-results");
+
+    // the chains of the finished search may be already displayed, then keep
+    // them to keep the selection and the scroll position
+    bool displayed = false;
+
+    if(m_stream && m_word == word)
+    {
+        slotTakeChains();
+        displayed = m_model->rowCount() == paths.size();
+    }
+
+    m_frameTimer.stop();
+    m_stream.clear();
 
     if(paths.isEmpty())
+    {
+        clear();
         return;
-
-    widget()->setUpdatesEnabled(false);
+    }
 
     // header with overview
-    QLabel *header = new QLabel(
-                         tr("Search time: <font color=green><b>%1ms</b></font>. "
-                            "Found chain(s): <font color=green><b>%2</b></font>. "
-                            "Longest word: <font color=green><b>%3</b></font> character(s)"
-                            )
-                            .arg(timeWithQuotes(elapsedTime))
-                            .arg(paths.size())
-                            .arg(paths.first().top().length())
-                         , widget());
-    header->adjustSize();
-    widget()->layout()->addWidget(header);
-
-    // also calculate the required width and height of the container
-    // to display scrollbars if necessary
-    int maxWidth = header->width();
-    int maxHeight = header->height();
+    m_header->setText(tr("Search time: <font color=green><b>%1ms</b></font>. "
+                         "Found chain(s): <font color=green><b>%2</b></font>. "
+                         "Longest word: <font color=green><b>%3</b></font> character(s)"
+                         )
+                         .arg(numberWithQuotes(elapsedTime))
+                         .arg(paths.size())
+                         .arg(paths.first().top().length()));
+
+    if(!statistics.isEmpty())
+    {
+        m_header->setText(m_header->text() + "<br>" + statisticsText(statistics));
+        m_header->setToolTip(statisticsToolTip(statistics));
+    }
+    else
+        m_header->setToolTip(QString());
+
+    m_header->show();
 
     // display the actual results
-    for(const LongestPath &stack : paths)
-    {
-        QStringList words = QStringList() << word;
+    if(!displayed)
+        m_model->setResults(word, paths);
+}
+
+void SearchResults::follow(const QString &word, const QSharedPointer<ChainStream> &stream)
+{
+    clear();
 
-        // +1 = starting word that is not included in the chain
-        words.reserve(stack.size()+1);
+    m_word = word;
+    m_stream = stream;
 
-        for(const std::string &str : stack)
-            words.append(QString::fromStdString(str));
+    m_header->setText(tr("Searching..."));
+    m_header->show();
 
-        SearchResultLabel *label = new SearchResultLabel(words, widget());
+    m_frameTimer.start();
+}
 
-        widget()->layout()->addWidget(label);
+void SearchResults::clear()
+{
+    m_frameTimer.stop();
+    m_stream.clear();
 
-        if(label->width() > maxWidth)
-            maxWidth = label->width();
+    m_header->hide();
+    m_header->clear();
+    m_header->setToolTip(QString());
 
-        maxHeight += label->height() + widget()->layout()->spacing();
-    }
+    m_model->clear();
+}
 
-    // add a vertical spacer
-    widget()->layout()->addItem(new QSpacerItem(1, 1, QSizePolicy::Minimum, QSizePolicy::Expanding));
+void SearchResults::slotTakeChains()
+{
+    if(!m_stream)
+        return;
+
+    bool reset;
+    const LongestPaths paths = m_stream->take(&reset);
+
+    if(paths.isEmpty() && !reset)
+        return;
 
-    // resize the container to its contents to show the scrollbars if necessary
-    widget()->setFixedWidth(maxWidth + widget()->layout()->margin()*2);
-    widget()->setFixedHeight(maxHeight + widget()->layout()->margin()*2);
+    // a longer chain has been found, the displayed chains are obsolete. The model
+    // just replaces its list, so it's cheap
+    if(reset)
+        m_model->setResults(m_word, paths);
+    else
+        m_model->appendResults(paths);
 
-    widget()->setUpdatesEnabled(true);
+    // the stream may be taken between the reset and the next chain
+    if(!m_model->rowCount())
+        return;
+
+    m_header->setText(tr("Searching... Found chain(s) so far: <font color=green><b>%1</b></font>. "
+                         "Longest word so far: <font color=green><b>%2</b></font> character(s)")
+                         .arg(m_model->rowCount())
+                         .arg(m_model->words(0).last().length()));
 }
 
-void SearchResults::clear()
+QString SearchResults::statisticsText(const SearchStatistics &statistics) const
+{
+    const DepthStatistics total = statistics.total();
+
+    return tr("Nodes expanded: <b>%1</b>. "
+              "Hash probes: <b>%2</b> (hits: <b>%3</b>). "
+              "Subtrees skipped: <b>%4</b>. "
+              "Max depth: <b>%5</b>. "
+              "New longest: <b>%6</b>. "
+              "Peak chains: <b>%7</b>")
+            .arg(numberWithQuotes(total.nodes))
+            .arg(numberWithQuotes(total.probes))
+            .arg(numberWithQuotes(total.hits))
+            .arg(numberWithQuotes(total.skipped))
+            .arg(statistics.maxDepth())
+            .arg(numberWithQuotes(statistics.newLongest))
+            .arg(numberWithQuotes(statistics.peakChains));
+}
+
+QString SearchResults::statisticsToolTip(const SearchStatistics &statistics) const
 {
-    // remove previous labels & layout
-    QWidget *widget = new QWidget;
-    widget->setLayout(new QVBoxLayout);
-    setWidget(widget);
+    QString result = "<table><tr><th>" + tr("Depth") + "</th><th>" + tr("Nodes") + "</th><th>"
+                     + tr("Probes") + "</th><th>" + tr("Hits") + "</th><th>" + tr("Skipped") + "</th></tr>";
+
+    for(int i = 0;i < statistics.depths.size();i++)
+    {
+        const DepthStatistics &depth = statistics.depths[i];
+
+        result += QString("<tr><td>%1</td><td align=right>%2</td><td align=right>%3</td>"
+                          "<td align=right>%4</td><td align=right>%5</td></tr>")
+                    .arg(i)
+                    .arg(numberWithQuotes(depth.nodes))
+                    .arg(numberWithQuotes(depth.probes))
+                    .arg(numberWithQuotes(depth.hits))
+                    .arg(numberWithQuotes(depth.skipped));
+    }
+
+    return result + "</table>";
 }
 
-QString SearchResults::timeWithQuotes(qint64 elapsedTime) const
+QString SearchResults::numberWithQuotes(qint64 number) const
 {
-    QString result = QString::number(elapsedTime);
+    QString result = QString::number(number);
 
     for(int i = result.length()-3;i > 0;i -= 3)
     {
@@ -30,6 +30,10 @@
 #include <QtCore>
 
 #include "longestpaths.h"
+#include "searchstatistics.h"
+#include "chainstream.h"
+
+class SearchResultModel;
 
 /*
  *  Widget to display search results as a number of chains like
@@ -37,14 +41,29 @@
  *  owl -> lowe -> ...
  *  owl -> awol -> ...
  *
- *  Each chain is represented by SearchResultLabel
+ *  The chains are displayed by a list view with SearchResultModel and SearchResultDelegate,
+ *  so only the visible chains are painted
  */
-class SearchResults : public QScrollArea
+class SearchResults : public QWidget
 {
+    Q_OBJECT
+
 public:
     explicit SearchResults(QWidget *parent = nullptr);
 
-    void loadResults(const QString &word, const LongestPaths &paths, qint64 elapsedTime);
+    /*
+     *  Display the chains. The search counters are displayed in the header if available
+     */
+    void loadResults(const QString &word,
+                     const LongestPaths &paths,
+                     qint64 elapsedTime,
+                     const SearchStatistics &statistics = SearchStatistics());
+
+    /*
+     *  Display the chains of a running search. The new chains are taken from the stream
+     *  and appended in batches once per frame, until loadResults() or clear() is called
+     */
+    void follow(const QString &word, const QSharedPointer<ChainStream> &stream);
 
     void clear();
 
@@ -52,7 +71,24 @@ private:
     /*
      *  Convert 48550 to "48'550"
      */
-    QString timeWithQuotes(qint64 elapsedTime) const;
+    QString numberWithQuotes(qint64 number) const;
+
+    /*
+     *  One line of the counters for the header, and a per-depth table for its tooltip
+     */
+    QString statisticsText(const SearchStatistics &statistics) const;
+    QString statisticsToolTip(const SearchStatistics &statistics) const;
+
+private slots:
+    void slotTakeChains();
+
+private:
+    QLabel *m_header;
+    QListView *m_view;
+    SearchResultModel *m_model;
+    QString m_word;
+    QSharedPointer<ChainStream> m_stream;
+    QTimer m_frameTimer;
 };
 
 #endif // SEARCHRESULTS_H
@@ -0,0 +1,76 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "searchstatistics.h"
+
+DepthStatistics SearchStatistics::total() const
+{
+    DepthStatistics result;
+
+    for(const DepthStatistics &depth : depths)
+    {
+        result.nodes += depth.nodes;
+        result.probes += depth.probes;
+        result.hits += depth.hits;
+        result.skipped += depth.skipped;
+    }
+
+    return result;
+}
+
+QJsonObject SearchStatistics::toJson() const
+{
+    const DepthStatistics totals = total();
+
+    QJsonObject object;
+
+    object["nodes_expanded"] = static_cast<double>(totals.nodes);
+    object["hash_probes"] = static_cast<double>(totals.probes);
+    object["hash_hits"] = static_cast<double>(totals.hits);
+    object["subtrees_skipped"] = static_cast<double>(totals.skipped);
+    object["max_depth"] = maxDepth();
+    object["new_longest"] = static_cast<double>(newLongest);
+    object["peak_chains"] = static_cast<double>(peakChains);
+
+    QJsonArray perDepth;
+
+    for(int i = 0;i < depths.size();i++)
+    {
+        QJsonObject depth;
+
+        depth["depth"] = i;
+        depth["nodes"] = static_cast<double>(depths[i].nodes);
+        depth["probes"] = static_cast<double>(depths[i].probes);
+        depth["hits"] = static_cast<double>(depths[i].hits);
+        depth["skipped"] = static_cast<double>(depths[i].skipped);
+
+        perDepth.append(depth);
+    }
+
+    object["depths"] = perDepth;
+    object["memory"] = memory.toJson();
+
+    return object;
+}
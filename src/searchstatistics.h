@@ -0,0 +1,104 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SEARCHSTATISTICS_H
+#define SEARCHSTATISTICS_H
+
+#include <QtCore>
+
+#include "memoryusage.h"
+
+/*
+ *  Counters of a single depth. The depth is the number of steps from the starting word:
+ *  a step of the derivation search may add several letters, and the reverse search and
+ *  the ladders count their levels the same way
+ */
+struct DepthStatistics
+{
+    DepthStatistics()
+        : nodes(0)
+        , probes(0)
+        , hits(0)
+        , skipped(0)
+    {}
+
+    // words expanded with the letters of the alphabet
+    qint64 nodes;
+    // index lookups
+    qint64 probes;
+    // index lookups which found an anagram group
+    qint64 hits;
+    // subtrees not walked because they are already a part of the longest chains
+    qint64 skipped;
+};
+
+/*
+ *  Counters of a single search. They are always collected, the cost is a few
+ *  increments per index lookup
+ */
+struct SearchStatistics
+{
+    SearchStatistics()
+        : newLongest(0)
+        , peakChains(0)
+    {}
+
+    /*
+     *  Total counters across all the depths
+     */
+    DepthStatistics total() const;
+
+    /*
+     *  Deepest expanded word
+     */
+    inline
+    int maxDepth() const;
+
+    inline
+    bool isEmpty() const;
+
+    QJsonObject toJson() const;
+
+    // times a new longest chain was found
+    qint64 newLongest;
+    // maximum number of the longest chains kept at once
+    qint64 peakChains;
+    // counters per depth, the first item is the starting word
+    QVector<DepthStatistics> depths;
+    // memory of the search state and the results at the end of the search
+    MemoryUsage memory;
+};
+
+int SearchStatistics::maxDepth() const
+{
+    return depths.size() - 1;
+}
+
+bool SearchStatistics::isEmpty() const
+{
+    return depths.isEmpty();
+}
+
+#endif // SEARCHSTATISTICS_H
@@ -40,6 +40,20 @@ Settings::Settings()
 QHash<QString, QVariant> Settings::defaultValues()
 {
     QHash<QString, QVariant> defaultValues;
+
+    defaultValues.insert(SETTING_RESULT_STORE, true);
+    defaultValues.insert(SETTING_INDEX_FILE, true);
+    // 0 = the number of CPU cores
+    defaultValues.insert(SETTING_SEARCH_THREADS, 0);
+    defaultValues.insert(SETTING_QUERY_LOG, false);
+    defaultValues.insert(SETTING_PROFILE_SEARCH, false);
+    // no constraints
+    defaultValues.insert(SETTING_EXCLUDED_LETTERS, QString());
+    defaultValues.insert(SETTING_REQUIRED_LETTERS, QString());
+    defaultValues.insert(SETTING_MAX_WORD_LENGTH, 0);
+    // a single letter per step
+    defaultValues.insert(SETTING_MAX_STEP, 1);
+
     return defaultValues;
 }
 
@@ -48,3 +62,8 @@ QRegExp Settings::wordValidator()
     // alow only Latin characters
     return QRegExp("[a-zA-Z]+");
 }
+
+QRegExp Settings::seedValidator()
+{
+    return QRegExp("[a-zA-Z?]+");
+}
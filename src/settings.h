@@ -35,11 +35,27 @@
 #define SETTINGS_GET_STRING Settings::instance()->value<QString>
 #define SETTINGS_SET_STRING Settings::instance()->setValue<QString>
 
+#define SETTINGS_GET_BOOL Settings::instance()->value<bool>
+#define SETTINGS_SET_BOOL Settings::instance()->setValue<bool>
+
+#define SETTINGS_GET_INT Settings::instance()->value<int>
+#define SETTINGS_SET_INT Settings::instance()->setValue<int>
+
 #define SETTINGS_REMOVE Settings::instance()->remove
 
 #define SETTING_WORD           "word"
 #define SETTING_DICTIONARY     "dictionary"
 #define SETTING_LAST_DIRECTORY "last-directory"
+#define SETTING_RESULT_STORE   "result-store"
+#define SETTING_INDEX_FILE     "index-file"
+#define SETTING_SEARCH_THREADS "search-threads"
+#define SETTING_QUERY_LOG      "query-log"
+#define SETTING_PROFILE_SEARCH "profile-search"
+#define SETTING_EXCLUDED_LETTERS "excluded-letters"
+#define SETTING_REQUIRED_LETTERS "required-letters"
+#define SETTING_MAX_WORD_LENGTH  "max-word-length"
+#define SETTING_MAX_STEP         "max-step"
+
 /*
  *  Application settings and global parameters like validation regexp
  */
@@ -56,6 +72,13 @@ public:
     static
     QRegExp wordValidator();
 
+    /*
+     *  Regexp to validate the starting word. It allows Latin characters
+     *  and the blanks ('?') standing for any letter
+     */
+    static
+    QRegExp seedValidator();
+
     /*
      *  The minimum length of the entered word
      */
@@ -0,0 +1,67 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SORTEDKEY_H
+#define SORTEDKEY_H
+
+#include <algorithm>
+#include <cstring>
+
+/*
+ *  Hardcode the alphabet since the character table is not continuous
+ *  according to the C++ standard, so we cannot reliably do
+ *
+ *  char ch = 'a';
+ *  ch++; // get 'b'
+ */
+constexpr const char *alphabet = "abcdefghijklmnopqrstuvwxyz";
+constexpr int alphabetSize = 26;
+
+/*
+ *  Insert the character into the sorted key at a correct place. 'result' must
+ *  have space for length+1 characters
+ */
+inline
+void insertIntoSortedKey(const char *key, int length, char ch, char *result)
+{
+    const int position = static_cast<int>(std::lower_bound(key, key + length, ch) - key);
+
+    std::memcpy(result, key, position);
+    result[position] = ch;
+    std::memcpy(result + position + 1, key + position, length - position);
+}
+
+/*
+ *  Remove the character at the position from the sorted key. 'result' must
+ *  have space for length-1 characters
+ */
+inline
+void removeFromSortedKey(const char *key, int length, int position, char *result)
+{
+    std::memcpy(result, key, position);
+    std::memcpy(result + position, key + position + 1, length - position - 1);
+}
+
+#endif // SORTEDKEY_H
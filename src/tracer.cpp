@@ -0,0 +1,161 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "tracer.h"
+
+QAtomicInt Tracer::m_enabled;
+
+Tracer *Tracer::instance()
+{
+    static Tracer *inst = new Tracer;
+    return inst;
+}
+
+Tracer::Tracer()
+{}
+
+void Tracer::start(const QString &path)
+{
+    QMutexLocker locker(&m_mutex);
+
+    qDebug("Tracing into \"%s\"", qPrintable(path));
+
+    m_path = path;
+    m_spans.clear();
+    m_timer.start();
+
+    m_enabled.storeRelease(1);
+}
+
+bool Tracer::save()
+{
+    if(!isEnabled())
+        return true;
+
+    QMutexLocker locker(&m_mutex);
+
+    const double pid = static_cast<double>(QCoreApplication::applicationPid());
+    QJsonArray events;
+
+    // names of the tracks
+    for(int i = 0;i < m_threadNames.size();i++)
+    {
+        QJsonObject event;
+        QJsonObject args;
+
+        args["name"] = m_threadNames[i];
+
+        event["name"] = "thread_name";
+        event["ph"] = "M";
+        event["pid"] = pid;
+        event["tid"] = i;
+        event["args"] = args;
+
+        events.append(event);
+    }
+
+    for(const Span &span : m_spans)
+    {
+        QJsonObject event;
+
+        event["name"] = span.name;
+        event["cat"] = "anagrams";
+        event["ph"] = "X";
+        event["ts"] = static_cast<double>(span.start);
+        event["dur"] = static_cast<double>(span.duration);
+        event["pid"] = pid;
+        event["tid"] = span.thread;
+
+        if(!span.detail.isEmpty())
+        {
+            QJsonObject args;
+            args["detail"] = span.detail;
+            event["args"] = args;
+        }
+
+        events.append(event);
+    }
+
+    QJsonObject root;
+    root["traceEvents"] = events;
+    root["displayTimeUnit"] = "ms";
+
+    QSaveFile file(m_path);
+
+    if(!file.open(QFile::WriteOnly)
+            || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) < 0
+            || !file.commit())
+    {
+        qWarning("Cannot save the trace: %s", qPrintable(file.errorString()));
+        return false;
+    }
+
+    qDebug("Saved %d span(s) into \"%s\"", m_spans.size(), qPrintable(m_path));
+
+    return true;
+}
+
+void Tracer::addSpan(const char *name, const QString &detail, qint64 start, qint64 duration)
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_spans.append({ name, detail, start, duration, currentThread() });
+}
+
+int Tracer::currentThread()
+{
+    QThread *thread = QThread::currentThread();
+    auto it = m_threads.constFind(thread);
+
+    if(it != m_threads.constEnd())
+        return it.value();
+
+    const int number = m_threadNames.size();
+
+    if(QCoreApplication::instance() && thread == QCoreApplication::instance()->thread())
+        m_threadNames.append("main");
+    else
+        m_threadNames.append(QString("worker %1").arg(number));
+
+    m_threads.insert(thread, number);
+
+    return number;
+}
+
+TraceSpan::TraceSpan(const char *name)
+    : m_name(name)
+    , m_start(-1)
+{
+    if(Tracer::isEnabled())
+        m_start = Tracer::instance()->now();
+}
+
+TraceSpan::~TraceSpan()
+{
+    if(m_start < 0)
+        return;
+
+    Tracer::instance()->addSpan(m_name, m_detail, m_start, Tracer::instance()->now() - m_start);
+}
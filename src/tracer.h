@@ -0,0 +1,151 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QtCore>
+
+/*
+ *  Opt-in recorder of timeline spans. The spans are saved in the Chrome trace format,
+ *  so the file can be opened in chrome://tracing or in the Perfetto UI. Every thread
+ *  gets its own track. Tracing is started with the ANAGRAMS_TRACE environment variable
+ *  in the app, or with the --trace option in the tools:
+ *
+ *  ANAGRAMS_TRACE=/tmp/anagrams.json anagrams
+ *
+ *  When tracing is disabled, a span costs a single atomic load
+ */
+class Tracer
+{
+public:
+    static
+    Tracer *instance();
+
+    /*
+     *  Start recording. The spans are written to 'path' with save()
+     */
+    void start(const QString &path);
+
+    /*
+     *  Write the recorded spans. Returns false on I/O errors
+     */
+    bool save();
+
+    static
+    inline
+    bool isEnabled();
+
+    /*
+     *  Record a finished span. Time is in microseconds since start()
+     */
+    void addSpan(const char *name, const QString &detail, qint64 start, qint64 duration);
+
+    /*
+     *  Microseconds since start()
+     */
+    inline
+    qint64 now() const;
+
+private:
+    Tracer();
+
+    struct Span
+    {
+        const char *name;
+        QString detail;
+        qint64 start;
+        qint64 duration;
+        int thread;
+    };
+
+    /*
+     *  Sequential number of the current thread. Must be called with the mutex locked
+     */
+    int currentThread();
+
+private:
+    static QAtomicInt m_enabled;
+    QString m_path;
+    QElapsedTimer m_timer;
+    QMutex m_mutex;
+    QVector<Span> m_spans;
+    QHash<QThread *, int> m_threads;
+    QStringList m_threadNames;
+};
+
+bool Tracer::isEnabled()
+{
+    return m_enabled.loadAcquire();
+}
+
+qint64 Tracer::now() const
+{
+    return m_timer.nsecsElapsed() / 1000;
+}
+
+/*
+ *  Span from the construction to the destruction of the object:
+ *
+ *  {
+ *      TraceSpan span("parse");
+ *      ...
+ *  }
+ *
+ *  The name must be a string literal. The detail is passed as a function returning
+ *  a QString, and it's called only when tracing is enabled, so a disabled span never
+ *  builds or copies its detail:
+ *
+ *  TraceSpan span("search", [&word] { return word; });
+ */
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char *name);
+
+    template<typename DetailFunction>
+    TraceSpan(const char *name, DetailFunction detail);
+
+    ~TraceSpan();
+
+private:
+    const char *m_name;
+    QString m_detail;
+    qint64 m_start;
+};
+
+template<typename DetailFunction>
+TraceSpan::TraceSpan(const char *name, DetailFunction detail)
+    : m_name(name)
+    , m_start(-1)
+{
+    if(!Tracer::isEnabled())
+        return;
+
+    m_detail = detail();
+    m_start = Tracer::instance()->now();
+}
+
+#endif // TRACER_H
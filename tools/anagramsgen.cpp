@@ -0,0 +1,105 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <QtCore>
+
+#include "dictionarygenerator.h"
+
+/*
+ *  Generator of synthetic dictionaries for the scaling and stress tests:
+ *
+ *  anagrams_gen --words 1000000 --fan-out 5 --chain-depth 20 --seed 42 --output big.txt
+ *
+ *  The same options always produce the same dictionary
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const DictionaryGenerator::Parameters defaults;
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generator of synthetic dictionaries for the anagram derivation finder");
+    parser.addHelpOption();
+
+    const QCommandLineOption outputOption("output", "Write the dictionary to the file instead of the standard output.", "path");
+    const QCommandLineOption seedOption("seed", "Random seed.", "seed", QString::number(defaults.seed));
+    const QCommandLineOption wordsOption("words", "Number of words.", "count", QString::number(defaults.words));
+    const QCommandLineOption minLengthOption("min-length", "Minimum word length.", "length", QString::number(defaults.minLength));
+    const QCommandLineOption maxLengthOption("max-length", "Maximum word length.", "length", QString::number(defaults.maxLength));
+    const QCommandLineOption meanLengthOption("mean-length", "Mean word length.", "length", QString::number(defaults.meanLength));
+    const QCommandLineOption alphabetOption("alphabet", "Number of letters to use.", "count", QString::number(defaults.alphabetSize));
+    const QCommandLineOption fanOutOption("fan-out", "Maximum number of anagrams of a single word.", "count", QString::number(defaults.fanOut));
+    const QCommandLineOption chainsOption("chains", "Number of planted derivation chains.", "count", QString::number(defaults.chains));
+    const QCommandLineOption chainDepthOption("chain-depth", "Length of the planted derivation chains.", "count", QString::number(defaults.chainDepth));
+    const QCommandLineOption seedsOption("print-seeds", "Print the starting words of the planted chains to the standard error.");
+
+    parser.addOptions({ outputOption, seedOption, wordsOption, minLengthOption, maxLengthOption, meanLengthOption,
+                        alphabetOption, fanOutOption, chainsOption, chainDepthOption, seedsOption });
+    parser.process(app);
+
+    DictionaryGenerator::Parameters parameters;
+
+    parameters.seed = parser.value(seedOption).toUInt();
+    parameters.words = parser.value(wordsOption).toLongLong();
+    parameters.minLength = parser.value(minLengthOption).toInt();
+    parameters.maxLength = parser.value(maxLengthOption).toInt();
+    parameters.meanLength = parser.value(meanLengthOption).toDouble();
+    parameters.alphabetSize = parser.value(alphabetOption).toInt();
+    parameters.fanOut = parser.value(fanOutOption).toInt();
+    parameters.chains = parser.value(chainsOption).toInt();
+    parameters.chainDepth = parser.value(chainDepthOption).toInt();
+
+    QFile file;
+
+    if(parser.isSet(outputOption))
+    {
+        file.setFileName(parser.value(outputOption));
+
+        if(!file.open(QFile::WriteOnly | QFile::Truncate))
+        {
+            qCritical("Cannot create the dictionary: %s", qPrintable(file.errorString()));
+            return 1;
+        }
+    }
+    else if(!file.open(stdout, QFile::WriteOnly))
+    {
+        qCritical("Cannot open the standard output");
+        return 1;
+    }
+
+    DictionaryGenerator generator(parameters);
+
+    if(!generator.generate(&file))
+    {
+        qCritical("Cannot write the dictionary: %s", qPrintable(file.errorString()));
+        return 1;
+    }
+
+    if(parser.isSet(seedsOption))
+        QTextStream(stderr) << generator.seeds().join('\n') << '\n';
+
+    return 0;
+}
@@ -23,50 +23,48 @@
     SOFTWARE.
 */
 
-#include "searchresultlabel.h"
+#include "dictionaryparser.h"
+#include "clicommon.h"
+#include "tracer.h"
 
-SearchResultLabel::SearchResultLabel(const QStringList &words, QWidget *parent)
-    : QWidget(parent)
+DictionaryIndex loadIndex(const QString &dictionaryPath)
 {
-    new QHBoxLayout(this);
+    TraceSpan span("load-dictionary");
 
-    const int arrowsNumber = words.size() - 1;
-    int arrowsCreated = 0;
+    DictionaryIndex index = DictionaryIndex::mapFile(dictionaryPath);
 
-    for(const QString &word : words)
+    if(!index.isNull())
+        return index;
+
+    QFile file(dictionaryPath);
+
+    if(!file.open(QFile::ReadOnly))
     {
-        QLabel *label = new QLabel(word, this);
-        label->setAlignment(Qt::AlignCenter);
-        layout()->addWidget(label);
-
-        if(arrowsCreated++ < arrowsNumber)
-        {
-            label = new QLabel(this);
-            label->setAlignment(Qt::AlignCenter);
-
-            label->setAlignment(Qt::AlignCenter);
-            label->setPixmap(arrowPixmap());
-            layout()->addWidget(label);
-        }
+        qCritical("Cannot open the dictionary: %s", qPrintable(file.errorString()));
+        return DictionaryIndex();
     }
 
-    layout()->addItem(new QSpacerItem(1, 1, QSizePolicy::Expanding));
+    DictionaryParser parser;
+    parser.parse(&file);
 
-    adjustSize();
-    setFixedSize(sizeHint());
+    return DictionaryIndex::build(parser.anagrams(), parser.fingerprint());
 }
 
-QPixmap SearchResultLabel::arrowPixmap() const
+QJsonArray chainsToJson(const QString &word, const LongestPaths &paths)
 {
-    constexpr const char *arrowPath = ":/images/arrow.png";
-
-    QPixmap pixmap;
+    QJsonArray chains;
 
-    if(!QPixmapCache::find(arrowPath, &pixmap))
+    for(const LongestPath &path : paths)
     {
-        pixmap.load(arrowPath);
-        QPixmapCache::insert(arrowPath, pixmap);
+        QJsonArray chain;
+
+        chain.append(word);
+
+        for(const std::string &str : path)
+            chain.append(QString::fromStdString(str));
+
+        chains.append(chain);
     }
 
-    return pixmap;
+    return chains;
 }
@@ -23,24 +23,22 @@
     SOFTWARE.
 */
 
-#ifndef SEARCHRESULTLABEL_H
-#define SEARCHRESULTLABEL_H
+#ifndef CLICOMMON_H
+#define CLICOMMON_H
 
-#include <QtWidgets>
+#include <QtCore>
+
+#include "dictionaryindex.h"
+#include "longestpaths.h"
 
 /*
- *  A single label representing a search result like
- *  owl -> lowe -> lower ->...
+ *  Map the saved index of the dictionary, or parse the dictionary if there is no valid index
  */
-class SearchResultLabel : public QWidget
-{
-    Q_OBJECT
-
-public:
-    SearchResultLabel(const QStringList &words, QWidget *parent = nullptr);
+DictionaryIndex loadIndex(const QString &dictionaryPath);
 
-private:
-    QPixmap arrowPixmap() const;
-};
+/*
+ *  Chains as JSON arrays of words, starting with the word
+ */
+QJsonArray chainsToJson(const QString &word, const LongestPaths &paths);
 
-#endif // SEARCHRESULTLABEL_H
+#endif // CLICOMMON_H
@@ -0,0 +1,488 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+
+#include "dictionarygenerator.h"
+#include "dictionaryparser.h"
+#include "dictionaryindex.h"
+#include "referencesearch.h"
+#include "reversesearch.h"
+#include "laddersearch.h"
+#include "racksearch.h"
+#include "chainenumerator.h"
+#include "anagramsearch.h"
+#include "commands.h"
+
+/*
+ *  Differential fuzzing. Generates random small dictionaries and starting words, and
+ *  compares the optimized searches (AnagramSearch and ChainEnumerator) with the slow
+ *  ReferenceSearch: the length of the longest chains, the set of their last words and
+ *  the validity of every chain. AnagramSearch is also compared with random constraints,
+ *  with the longer steps and with the starting words containing blanks. ReverseSearch
+ *  is compared with the shortest words the reference search finds for random targets,
+ *  LadderSearch with the shortest chains between random words, and RackSearch with the
+ *  words made of the letters of random racks.
+ *  A failing dictionary is saved to reproduce the failure:
+ *
+ *  anagrams_cli fuzz --iterations 100000 --seed 7
+ */
+
+namespace
+{
+
+struct Failure
+{
+    QString word;
+    QString reason;
+};
+
+QString chainToString(const QString &word, const LongestPath &chain)
+{
+    QStringList words(word);
+
+    for(const std::string &str : chain)
+        words.append(QString::fromStdString(str));
+
+    return words.join(" -> ");
+}
+
+/*
+ *  Compare AnagramSearch for a single starting word. Returns false on the first difference
+ */
+bool compareSearch(const DictionaryIndex &index,
+                   ReferenceSearch *reference,
+                   const QString &word,
+                   const SearchConstraints &constraints,
+                   Failure *failure)
+{
+    const QString prefix = constraints.isEmpty() ? QString("AnagramSearch")
+                                                 : QString("AnagramSearch (%1)").arg(constraints.toString());
+
+    reference->setConstraints(constraints);
+
+    std::set<std::string> expectedLastWords;
+    const int expectedLength = reference->find(word, &expectedLastWords);
+
+    AnagramSearch search(index);
+    search.setConstraints(constraints);
+
+    const LongestPaths paths = search.find(word);
+    std::set<std::string> lastWords;
+
+    for(const LongestPath &path : paths)
+    {
+        QString error;
+
+        if(path.size() != expectedLength)
+        {
+            failure->reason = QString("%1: chain length %2, expected %3: %4")
+                                .arg(prefix).arg(path.size()).arg(expectedLength).arg(chainToString(word, path));
+            return false;
+        }
+
+        if(!reference->isValidChain(word, path, &error))
+        {
+            failure->reason = QString("%1: invalid chain %2: %3").arg(prefix, chainToString(word, path), error);
+            return false;
+        }
+
+        if(!lastWords.insert(path.top()).second)
+        {
+            failure->reason = QString("%1: duplicate last word \"%2\"").arg(prefix, QString::fromStdString(path.top()));
+            return false;
+        }
+    }
+
+    if(paths.isEmpty() && expectedLength)
+    {
+        failure->reason = QString("%1: no chains, expected length %2").arg(prefix).arg(expectedLength);
+        return false;
+    }
+
+    if(lastWords != expectedLastWords)
+    {
+        failure->reason = QString("%1: %2 last word(s), expected %3").arg(prefix).arg(lastWords.size()).arg(expectedLastWords.size());
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  Compare the searches for a single starting word. Returns false on the first difference
+ */
+bool compare(const DictionaryIndex &index,
+             ReferenceSearch *reference,
+             const QString &word,
+             const SearchConstraints &constraints,
+             Failure *failure)
+{
+    failure->word = word;
+
+    if(!compareSearch(index, reference, word, SearchConstraints(), failure))
+        return false;
+
+    if(!constraints.isEmpty() && !compareSearch(index, reference, word, constraints, failure))
+        return false;
+
+    // ChainEnumerator doesn't support the constraints and the blanks
+    if(word.contains(AnagramSearch::BLANK))
+        return true;
+
+    reference->setConstraints(SearchConstraints());
+
+    std::set<std::string> expectedLastWords;
+    const int expectedLength = reference->find(word, &expectedLastWords);
+
+    ChainEnumerator enumerator(index, word);
+
+    if(enumerator.longestChainLength() != expectedLength)
+    {
+        failure->reason = QString("ChainEnumerator: chain length %1, expected %2")
+                            .arg(enumerator.longestChainLength()).arg(expectedLength);
+        return false;
+    }
+
+    LongestPath chain;
+    std::set<std::string> lastWords;
+
+    while(enumerator.next(&chain))
+    {
+        QString error;
+
+        if(chain.size() != expectedLength || !reference->isValidChain(word, chain, &error))
+        {
+            failure->reason = QString("ChainEnumerator: invalid chain %1 %2").arg(chainToString(word, chain), error);
+            return false;
+        }
+
+        lastWords.insert(chain.top());
+    }
+
+    if(lastWords != expectedLastWords)
+    {
+        failure->reason = QString("ChainEnumerator: %1 last word(s), expected %2").arg(lastWords.size()).arg(expectedLastWords.size());
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  Compare ReverseSearch for a single target. Returns false on the first difference
+ */
+bool compareReverse(const DictionaryIndex &index, ReferenceSearch *reference, const QString &target, Failure *failure)
+{
+    failure->word = target;
+
+    // the chains are checked with the classic derivation
+    reference->setConstraints(SearchConstraints());
+
+    std::set<std::string> expectedSeeds;
+    const int expectedLength = reference->findSeeds(target, &expectedSeeds);
+
+    const LongestPaths chains = ReverseSearch(index).find(target);
+    std::set<std::string> seeds;
+
+    for(const LongestPath &chain : chains)
+    {
+        // the last step is checked against the target, which may be not in the dictionary
+        LongestPath derived = chain;
+        derived.remove(0);
+        derived.pop();
+
+        const QString seed = QString::fromStdString(chain.first());
+        std::string last = derived.isEmpty() ? chain.first() : derived.top();
+        std::string targetKey = target.toStdString();
+        QString error;
+
+        std::sort(last.begin(), last.end());
+        std::sort(targetKey.begin(), targetKey.end());
+
+        if(chain.size() != expectedLength + 1
+                || chain.top() != target.toStdString()
+                || !reference->isValidChain(seed, derived, &error)
+                || last.length() + 1 != targetKey.length()
+                || !std::includes(targetKey.begin(), targetKey.end(), last.begin(), last.end()))
+        {
+            failure->reason = QString("ReverseSearch: invalid chain %1 %2").arg(chainToString(seed, derived), error);
+            return false;
+        }
+
+        if(!seeds.insert(chain.first()).second)
+        {
+            failure->reason = QString("ReverseSearch: duplicate seed \"%1\"").arg(seed);
+            return false;
+        }
+    }
+
+    if(seeds != expectedSeeds)
+    {
+        failure->reason = QString("ReverseSearch: %1 seed(s), expected %2").arg(seeds.size()).arg(expectedSeeds.size());
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  Compare LadderSearch for a pair of words. Returns false on the first difference
+ */
+bool compareLadder(const DictionaryIndex &index,
+                   const ReferenceSearch &reference,
+                   const QString &from,
+                   const QString &to,
+                   bool allowRemovals,
+                   Failure *failure)
+{
+    failure->word = from + " -> " + to;
+
+    qint64 expectedChains = 0;
+    const int expectedLength = reference.findLadder(from, to, allowRemovals, &expectedChains);
+
+    LadderSearch search(index);
+    search.setAllowRemovals(allowRemovals);
+
+    const QString prefix = allowRemovals ? QString("LadderSearch (with removals)") : QString("LadderSearch");
+    const LongestPaths chains = search.find(from, to, -1);
+    std::set<std::vector<std::string>> unique;
+
+    for(const LongestPath &chain : chains)
+    {
+        bool valid = chain.size() == expectedLength + 1 && chain.first() == from.toStdString()
+                        && (!expectedLength || chain.top() == to.toStdString());
+
+        for(int i = 1;valid && i < chain.size();i++)
+        {
+            std::string previous = chain[i - 1];
+            std::string current = chain[i];
+
+            std::sort(previous.begin(), previous.end());
+            std::sort(current.begin(), current.end());
+
+            const bool added = current.length() == previous.length() + 1
+                                && std::includes(current.begin(), current.end(), previous.begin(), previous.end());
+            const bool removed = allowRemovals
+                                && previous.length() == current.length() + 1
+                                && std::includes(previous.begin(), previous.end(), current.begin(), current.end());
+
+            // only the two words may be not in the dictionary
+            valid = (added || removed) && (i == chain.size() - 1 || !index.group(current).isEmpty());
+        }
+
+        if(!valid || !unique.insert(chain.toStdVector()).second)
+        {
+            LongestPath steps = chain;
+            steps.remove(0);
+
+            failure->reason = QString("%1: invalid or duplicate chain %2").arg(prefix, chainToString(from, steps));
+            return false;
+        }
+    }
+
+    if((expectedLength < 0 && !chains.isEmpty()) || (expectedLength >= 0 && chains.size() != expectedChains))
+    {
+        failure->reason = QString("%1: %2 chain(s), expected %3 of %4 step(s)")
+                            .arg(prefix).arg(chains.size()).arg(expectedChains).arg(expectedLength);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  Compare RackSearch for a single rack. Returns false on the first difference
+ */
+bool compareRack(const DictionaryIndex &index, const ReferenceSearch &reference, const QString &rack, Failure *failure)
+{
+    failure->word = rack;
+
+    std::set<std::string> expectedWords;
+    reference.findRackWords(rack, &expectedWords);
+
+    std::set<std::string> words;
+
+    for(const DictionaryIndex::Group &group : RackSearch(index).find(rack))
+    {
+        for(int i = 0;i < group.size();i++)
+            words.insert(group.wordString(i));
+    }
+
+    if(words != expectedWords)
+    {
+        failure->reason = QString("RackSearch: %1 word(s), expected %2").arg(words.size()).arg(expectedWords.size());
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+int commandFuzz(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compare the optimized searches with the reference search on random dictionaries");
+    parser.addHelpOption();
+
+    const QCommandLineOption iterationsOption("iterations", "Number of random dictionaries.", "count", "10000");
+    const QCommandLineOption seedOption("seed", "Random seed.", "seed", "1");
+    const QCommandLineOption maxWordsOption("max-words", "Maximum size of the dictionaries.", "count", "300");
+    const QCommandLineOption failureOption("failure", "Save the failing dictionary to the file.", "path", "fuzz-failure.txt");
+
+    parser.addOptions({ iterationsOption, seedOption, maxWordsOption, failureOption });
+    parser.process(arguments);
+
+    const int iterations = parser.value(iterationsOption).toInt();
+    const int maxWords = std::max(1, parser.value(maxWordsOption).toInt());
+    std::mt19937 engine(parser.value(seedOption).toUInt());
+    QTextStream out(stdout);
+
+    for(int iteration = 0;iteration < iterations;iteration++)
+    {
+        // small alphabets and short words produce deep and bushy chains
+        DictionaryGenerator::Parameters parameters;
+
+        parameters.seed = engine();
+        parameters.words = 1 + engine() % maxWords;
+        parameters.alphabetSize = 2 + engine() % 7;
+        parameters.minLength = 1 + engine() % 3;
+        parameters.maxLength = parameters.minLength + 1 + engine() % 8;
+        parameters.meanLength = (parameters.minLength + parameters.maxLength) / 2.0;
+        parameters.fanOut = 1 + engine() % 4;
+        parameters.chains = engine() % 4;
+        parameters.chainDepth = 1 + engine() % 8;
+
+        DictionaryGenerator generator(parameters);
+        const QByteArray contents = generator.generate();
+
+        QBuffer buffer;
+        buffer.setData(contents);
+        buffer.open(QIODevice::ReadOnly);
+
+        DictionaryParser dictionaryParser;
+        dictionaryParser.parse(&buffer);
+
+        const Anagrams anagrams = dictionaryParser.anagrams();
+        const DictionaryIndex index = DictionaryIndex::build(anagrams, dictionaryParser.fingerprint());
+        ReferenceSearch reference(anagrams);
+
+        QStringList words = generator.seeds();
+
+        // random short words, including the ones outside of the chains
+        for(int i = 0;i < 3;i++)
+        {
+            QString word;
+            const int length = 1 + engine() % 3;
+
+            for(int j = 0;j < length;j++)
+                word += QChar('a' + engine() % parameters.alphabetSize);
+
+            words.append(word);
+        }
+
+        // a random word with one or two blanks
+        {
+            QString word;
+            const int length = engine() % 3;
+
+            for(int j = 0;j < length;j++)
+                word += QChar('a' + engine() % parameters.alphabetSize);
+
+            for(int j = 1 + engine() % 2;j > 0;j--)
+                word.insert(engine() % (word.length() + 1), QChar(AnagramSearch::BLANK));
+
+            words.append(word);
+        }
+
+        // the targets of the reverse search: random words of the dictionary,
+        // and a random longer word which is not in the dictionary likely
+        QStringList targets;
+
+        for(int i = 0;i < 3 && !anagrams.isEmpty();i++)
+            targets.append(QString::fromStdString(std::next(anagrams.constBegin(), static_cast<int>(engine() % anagrams.size())).value().first()));
+
+        {
+            QString target;
+            const int length = 3 + engine() % 6;
+
+            for(int j = 0;j < length;j++)
+                target += QChar('a' + engine() % parameters.alphabetSize);
+
+            targets.append(target);
+        }
+
+        for(const QString &word : words)
+        {
+            // a few random letters of the alphabet, and a limit
+            // a little longer than the starting word
+            SearchConstraints constraints;
+
+            for(int i = engine() % 3;i > 0;i--)
+                constraints.excludedLetters += QChar('a' + engine() % parameters.alphabetSize);
+
+            for(int i = engine() % 3;i > 0;i--)
+                constraints.requiredLetters += QChar('a' + engine() % parameters.alphabetSize);
+
+            if(engine() % 2)
+                constraints.maxLength = word.length() + 1 + engine() % 6;
+
+            if(engine() % 3 == 0)
+                constraints.maxStep = 2 + engine() % 2;
+
+            Failure failure;
+
+            if(compare(index, &reference, word, constraints, &failure)
+                    && compareReverse(index, &reference, targets.at(engine() % targets.size()), &failure)
+                    && compareLadder(index, reference, word, targets.at(engine() % targets.size()), engine() % 2, &failure)
+                    && compareRack(index, reference, word + targets.at(engine() % targets.size()), &failure))
+                continue;
+
+            QFile file(parser.value(failureOption));
+
+            if(!file.open(QFile::WriteOnly | QFile::Truncate) || file.write(contents) != contents.size())
+                qWarning("Cannot save the failing dictionary: %s", qPrintable(file.errorString()));
+
+            out << "FAIL at iteration " << iteration << ", word \"" << failure.word << "\": " << failure.reason << '\n'
+                << "The dictionary is saved into " << file.fileName() << '\n';
+
+            return 1;
+        }
+
+        if((iteration + 1) % 1000 == 0)
+        {
+            out << iteration + 1 << " iteration(s) passed\n";
+            out.flush();
+        }
+    }
+
+    out << "All " << iterations << " iteration(s) passed\n";
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "laddersearch.h"
+#include "clicommon.h"
+#include "commands.h"
+#include "tracer.h"
+
+int commandLadder(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Find the shortest chains from one word to another");
+    parser.addHelpOption();
+    parser.addPositionalArgument("from", "First word.");
+    parser.addPositionalArgument("to", "Last word.");
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to search in.", "path");
+    const QCommandLineOption removalsOption("removals", "Allow the steps removing a letter.");
+    const QCommandLineOption allOption("all", "Print all the shortest chains, not only the first one.");
+    const QCommandLineOption jsonOption("json", "Print the chains and the search counters as JSON.");
+    const QCommandLineOption statisticsOption("statistics", "Print the search counters.");
+    const QCommandLineOption traceOption("trace", "Save the timeline of the phases in the Chrome trace format.", "path");
+
+    parser.addOptions({ dictionaryOption, removalsOption, allOption, jsonOption, statisticsOption, traceOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(dictionaryOption) || parser.positionalArguments().size() != 2)
+        parser.showHelp(1);
+
+    if(parser.isSet(traceOption))
+        Tracer::instance()->start(parser.value(traceOption));
+
+    const DictionaryIndex index = loadIndex(parser.value(dictionaryOption));
+
+    if(index.isNull())
+        return 1;
+
+    const QString from = parser.positionalArguments().at(0);
+    const QString to = parser.positionalArguments().at(1);
+
+    LadderSearch search(index);
+    search.setAllowRemovals(parser.isSet(removalsOption));
+
+    SearchStatistics statistics;
+    QElapsedTimer timer;
+    timer.start();
+
+    const LongestPaths chains = search.find(from, to, parser.isSet(allOption) ? -1 : 1, &statistics);
+    const qint64 elapsed = timer.nsecsElapsed();
+
+    QTextStream out(stdout);
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonObject root;
+        QJsonArray jsonChains;
+
+        for(const LongestPath &chain : chains)
+        {
+            QJsonArray jsonChain;
+
+            for(const std::string &str : chain)
+                jsonChain.append(QString::fromStdString(str));
+
+            jsonChains.append(jsonChain);
+        }
+
+        root["dictionary"] = parser.value(dictionaryOption);
+        root["from"] = from;
+        root["to"] = to;
+        root["time_ms"] = elapsed / 1e6;
+        root["chains"] = jsonChains;
+        root["statistics"] = statistics.toJson();
+
+        out << QJsonDocument(root).toJson();
+    }
+    else
+    {
+        out << from << " -> " << to << ": ";
+
+        if(chains.isEmpty())
+            out << "no chains";
+        else
+            out << chains.size() << " chain(s) of " << chains.first().size() - 1 << " step(s)";
+
+        out << " in " << QString::number(elapsed / 1e6, 'f', 3) << "ms\n";
+
+        for(const LongestPath &chain : chains)
+        {
+            QStringList words;
+
+            for(const std::string &str : chain)
+                words.append(QString::fromStdString(str));
+
+            out << "    " << words.join(" -> ") << '\n';
+        }
+
+        if(parser.isSet(statisticsOption))
+        {
+            for(int i = 0;i < statistics.depths.size();i++)
+            {
+                const DepthStatistics &depth = statistics.depths[i];
+
+                out << "    level " << i
+                    << ": keys " << depth.nodes
+                    << ", probes " << depth.probes
+                    << ", hits " << depth.hits
+                    << ", found before " << depth.skipped << '\n';
+            }
+        }
+    }
+
+    return Tracer::instance()->save() ? 0 : 1;
+}
@@ -0,0 +1,230 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <cstdio>
+
+#include "bulklookup.h"
+#include "clicommon.h"
+#include "commands.h"
+#include "tracer.h"
+
+namespace
+{
+
+// words looked up by a worker at once
+constexpr int LOOKUP_CHUNK_SIZE = 4096;
+
+/*
+ *  Chunk of the input lines and the formatted groups of its words
+ */
+struct LookupChunk
+{
+    LookupChunk()
+        : found(0)
+    {}
+
+    QList<QByteArray> words;
+    QByteArray output;
+    int found;
+};
+
+/*
+ *  Worker looking up the chunks of a block until there are no more chunks
+ */
+class LookupWorker : public QRunnable
+{
+public:
+    LookupWorker(const DictionaryIndex &index, QVector<LookupChunk> *chunks, QAtomicInt *nextChunk)
+        : m_index(index)
+        , m_chunks(chunks)
+        , m_nextChunk(nextChunk)
+    {}
+
+    virtual void run() override
+    {
+        BulkLookup lookup(m_index);
+
+        for(int i = m_nextChunk->fetchAndAddRelaxed(1);i < m_chunks->size();i = m_nextChunk->fetchAndAddRelaxed(1))
+        {
+            LookupChunk &chunk = (*m_chunks)[i];
+            const QVector<DictionaryIndex::Group> groups = lookup.find(chunk.words);
+
+            for(int w = 0;w < groups.size();w++)
+            {
+                const DictionaryIndex::Group &group = groups.at(w);
+
+                chunk.output += chunk.words.at(w);
+                chunk.output += '\t';
+
+                for(int g = 0;g < group.size();g++)
+                {
+                    if(g)
+                        chunk.output += ' ';
+
+                    chunk.output.append(group.word(g), group.wordLength());
+                }
+
+                chunk.output += '\n';
+                chunk.found += !group.isEmpty();
+            }
+        }
+    }
+
+private:
+    const DictionaryIndex &m_index;
+    QVector<LookupChunk> *m_chunks;
+    QAtomicInt *m_nextChunk;
+};
+
+/*
+ *  Read up to 'count' non-empty lines into chunks
+ */
+QVector<LookupChunk> readBlock(QIODevice *device, int count)
+{
+    QVector<LookupChunk> chunks;
+    int lines = 0;
+
+    while(lines < count && !device->atEnd())
+    {
+        const QByteArray line = device->readLine().trimmed();
+
+        if(line.isEmpty())
+            continue;
+
+        if(chunks.isEmpty() || chunks.last().words.size() == LOOKUP_CHUNK_SIZE)
+            chunks.append(LookupChunk());
+
+        chunks.last().words.append(line);
+        lines++;
+    }
+
+    return chunks;
+}
+
+}
+
+int commandLookup(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Print the anagram groups of the words read line by line");
+    parser.addHelpOption();
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to search in.", "path");
+    const QCommandLineOption inputOption("input", "File with the words, one per line. The standard input by default.", "path");
+    const QCommandLineOption concurrencyOption("concurrency", "Number of concurrent workers.", "count",
+                                               QString::number(QThread::idealThreadCount()));
+    const QCommandLineOption blockOption("block", "Number of words read while the previous words are looked up.", "count", "262144");
+    const QCommandLineOption traceOption("trace", "Save the timeline of the phases in the Chrome trace format.", "path");
+
+    parser.addOptions({ dictionaryOption, inputOption, concurrencyOption, blockOption, traceOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(dictionaryOption))
+        parser.showHelp(1);
+
+    if(parser.isSet(traceOption))
+        Tracer::instance()->start(parser.value(traceOption));
+
+    const DictionaryIndex index = loadIndex(parser.value(dictionaryOption));
+
+    if(index.isNull())
+        return 1;
+
+    QFile input;
+
+    if(parser.isSet(inputOption))
+    {
+        input.setFileName(parser.value(inputOption));
+
+        if(!input.open(QIODevice::ReadOnly))
+        {
+            qCritical("Cannot open %s: %s", qPrintable(input.fileName()), qPrintable(input.errorString()));
+            return 1;
+        }
+    }
+    else if(!input.open(stdin, QIODevice::ReadOnly))
+    {
+        qCritical("Cannot open the standard input: %s", qPrintable(input.errorString()));
+        return 1;
+    }
+
+    QFile output;
+
+    if(!output.open(stdout, QIODevice::WriteOnly))
+    {
+        qCritical("Cannot open the standard output: %s", qPrintable(output.errorString()));
+        return 1;
+    }
+
+    const int concurrency = std::max(1, parser.value(concurrencyOption).toInt());
+    const int blockSize = std::max(1, parser.value(blockOption).toInt());
+    qint64 words = 0;
+    qint64 found = 0;
+    QThreadPool pool;
+
+    pool.setMaxThreadCount(concurrency);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QVector<LookupChunk> block = readBlock(&input, blockSize);
+
+    // the workers look up a block while the next block is read, and the previous one is written
+    while(!block.isEmpty())
+    {
+        QAtomicInt nextChunk(0);
+
+        for(int i = 0;i < std::min(concurrency, block.size());i++)
+            pool.start(new LookupWorker(index, &block, &nextChunk));
+
+        QVector<LookupChunk> nextBlock = readBlock(&input, blockSize);
+
+        pool.waitForDone();
+
+        for(const LookupChunk &chunk : block)
+        {
+            output.write(chunk.output);
+            words += chunk.words.size();
+            found += chunk.found;
+        }
+
+        block = std::move(nextBlock);
+    }
+
+    output.flush();
+
+    const double wallTime = timer.nsecsElapsed() / 1e9;
+    const double throughput = wallTime > 0 ? words / wallTime : 0;
+
+    QTextStream err(stderr);
+
+    err << "Words:        " << words << '\n'
+        << "Found:        " << found << '\n'
+        << "Concurrency:  " << concurrency << '\n'
+        << "Wall time:    " << QString::number(wallTime, 'f', 3) << "s\n"
+        << "Throughput:   " << QString::number(throughput, 'f', 1) << " words/s\n";
+
+    return Tracer::instance()->save() ? 0 : 1;
+}
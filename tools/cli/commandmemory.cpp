@@ -0,0 +1,95 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "dictionaryparser.h"
+#include "dictionaryindex.h"
+#include "keytrie.h"
+#include "commands.h"
+
+int commandMemory(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Report the memory used by the parsed dictionary and by its index");
+    parser.addHelpOption();
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to load.", "path");
+    const QCommandLineOption jsonOption("json", "Print the report as JSON.");
+    const QCommandLineOption trieOption("trie", "Build the key trie of the wildcard, multi-letter step and rack queries, and include it.");
+
+    parser.addOptions({ dictionaryOption, jsonOption, trieOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(dictionaryOption))
+        parser.showHelp(1);
+
+    QFile file(parser.value(dictionaryOption));
+
+    if(!file.open(QFile::ReadOnly))
+    {
+        qCritical("Cannot open the dictionary: %s", qPrintable(file.errorString()));
+        return 1;
+    }
+
+    DictionaryParser dictionaryParser;
+    dictionaryParser.parse(&file);
+
+    const Anagrams anagrams = dictionaryParser.anagrams();
+    const DictionaryIndex index = DictionaryIndex::build(anagrams, dictionaryParser.fingerprint());
+
+    if(index.isNull())
+    {
+        qCritical("Cannot index the dictionary");
+        return 1;
+    }
+
+    if(parser.isSet(trieOption))
+        index.trie();
+
+    // the hash exists only while loading, the index is what stays in memory
+    const MemoryUsage parsed = MemoryUsage::ofAnagrams(anagrams);
+    const MemoryUsage indexed = index.memoryUsage();
+
+    QTextStream out(stdout);
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonObject root;
+
+        root["dictionary"] = parser.value(dictionaryOption);
+        root["file_bytes"] = static_cast<double>(file.size());
+        root["parsed"] = parsed.toJson();
+        root["index"] = indexed.toJson();
+
+        out << QJsonDocument(root).toJson();
+    }
+    else
+    {
+        out << "Dictionary file: " << MemoryUsage::formatBytes(file.size()) << "\n\n"
+            << "Parsed dictionary (estimate):\n" << parsed.toString() << '\n'
+            << "Index:\n" << indexed.toString();
+    }
+
+    return 0;
+}
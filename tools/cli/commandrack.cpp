@@ -0,0 +1,199 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "racksearch.h"
+#include "clicommon.h"
+#include "commands.h"
+#include "keytrie.h"
+#include "tracer.h"
+
+namespace
+{
+
+/*
+ *  Worker answering the racks until there are no more racks
+ */
+class RackWorker : public QRunnable
+{
+public:
+    RackWorker(const DictionaryIndex &index, const QStringList &racks, int minLength, QAtomicInt *nextRack, QAtomicInt *groups)
+        : m_index(index)
+        , m_racks(racks)
+        , m_minLength(minLength)
+        , m_nextRack(nextRack)
+        , m_groups(groups)
+    {}
+
+    virtual void run() override
+    {
+        const RackSearch search(m_index);
+        int groups = 0;
+
+        for(int i = m_nextRack->fetchAndAddRelaxed(1);i < m_racks.size();i = m_nextRack->fetchAndAddRelaxed(1))
+            groups += search.find(m_racks[i], m_minLength).size();
+
+        m_groups->fetchAndAddRelaxed(groups);
+    }
+
+private:
+    const DictionaryIndex &m_index;
+    const QStringList &m_racks;
+    const int m_minLength;
+    QAtomicInt *m_nextRack;
+    QAtomicInt *m_groups;
+};
+
+}
+
+int commandRack(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Find the words made of the letters of the racks");
+    parser.addHelpOption();
+    parser.addPositionalArgument("racks", "Letters of the racks, '?' is a blank.", "racks...");
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to search in.", "path");
+    const QCommandLineOption minLengthOption("min-length", "Minimum length of the words.", "length", "2");
+    const QCommandLineOption jsonOption("json", "Print the words as JSON.");
+    const QCommandLineOption repeatOption("repeat", "Answer the racks this many times and report the throughput instead of the words.", "count", "1");
+    const QCommandLineOption concurrencyOption("concurrency", "Number of concurrent workers with --repeat.", "count", "1");
+    const QCommandLineOption traceOption("trace", "Save the timeline of the phases in the Chrome trace format.", "path");
+
+    parser.addOptions({ dictionaryOption, minLengthOption, jsonOption, repeatOption, concurrencyOption, traceOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(dictionaryOption) || parser.positionalArguments().isEmpty())
+        parser.showHelp(1);
+
+    if(parser.isSet(traceOption))
+        Tracer::instance()->start(parser.value(traceOption));
+
+    const DictionaryIndex index = loadIndex(parser.value(dictionaryOption));
+
+    if(index.isNull())
+        return 1;
+
+    const int minLength = parser.value(minLengthOption).toInt();
+    const int repeat = std::max(1, parser.value(repeatOption).toInt());
+    QTextStream out(stdout);
+
+    // build the trie now, it's not a part of the queries
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        const KeyTrie &trie = index.trie();
+
+        qDebug("Key trie of %d nodes has been built in %.3fms", trie.size(), timer.nsecsElapsed() / 1e6);
+    }
+
+    if(repeat > 1)
+    {
+        QStringList racks;
+
+        for(int i = 0;i < repeat;i++)
+            racks += parser.positionalArguments();
+
+        const int concurrency = std::max(1, parser.value(concurrencyOption).toInt());
+        QAtomicInt nextRack(0);
+        QAtomicInt groups(0);
+        QThreadPool pool;
+
+        pool.setMaxThreadCount(concurrency);
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for(int i = 0;i < concurrency;i++)
+            pool.start(new RackWorker(index, racks, minLength, &nextRack, &groups));
+
+        pool.waitForDone();
+
+        const double wallTime = timer.nsecsElapsed() / 1e9;
+        const double throughput = wallTime > 0 ? racks.size() / wallTime : 0;
+
+        out << "Racks:        " << racks.size() << '\n'
+            << "Groups:       " << groups.loadAcquire() << '\n'
+            << "Concurrency:  " << concurrency << '\n'
+            << "Wall time:    " << QString::number(wallTime, 'f', 3) << "s\n"
+            << "Throughput:   " << QString::number(throughput, 'f', 1) << " racks/s\n";
+
+        return Tracer::instance()->save() ? 0 : 1;
+    }
+
+    const RackSearch search(index);
+    QJsonArray queries;
+
+    for(const QString &rack : parser.positionalArguments())
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        const QVector<DictionaryIndex::Group> groups = search.find(rack, minLength);
+        const qint64 elapsed = timer.nsecsElapsed();
+
+        if(parser.isSet(jsonOption))
+        {
+            QJsonObject query;
+            QJsonArray words;
+
+            for(const DictionaryIndex::Group &group : groups)
+            {
+                for(int i = 0;i < group.size();i++)
+                    words.append(QString::fromStdString(group.wordString(i)));
+            }
+
+            query["rack"] = rack;
+            query["time_ms"] = elapsed / 1e6;
+            query["words"] = words;
+
+            queries.append(query);
+            continue;
+        }
+
+        out << rack << ": " << groups.size() << " group(s) in " << QString::number(elapsed / 1e6, 'f', 3) << "ms\n";
+
+        for(const DictionaryIndex::Group &group : groups)
+        {
+            QStringList words;
+
+            for(int i = 0;i < group.size();i++)
+                words.append(QString::fromStdString(group.wordString(i)));
+
+            out << "    " << words.join(", ") << '\n';
+        }
+    }
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonObject root;
+        root["dictionary"] = parser.value(dictionaryOption);
+        root["queries"] = queries;
+
+        out << QJsonDocument(root).toJson();
+    }
+
+    return Tracer::instance()->save() ? 0 : 1;
+}
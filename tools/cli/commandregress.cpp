@@ -0,0 +1,370 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "dictionarygenerator.h"
+#include "dictionaryparser.h"
+#include "dictionaryindex.h"
+#include "anagramsearch.h"
+#include "commands.h"
+
+/*
+ *  Regression harness. Runs a fixed corpus of generated dictionaries and starting words,
+ *  and compares the results with the golden results recorded earlier: the chain length,
+ *  the number of chains and the set of chains. The search time is compared too, and
+ *  a slowdown above the threshold is a failure:
+ *
+ *  anagrams_cli regress --record golden.json
+ *  ... optimize ...
+ *  anagrams_cli regress --check golden.json --threshold 0.1
+ *
+ *  The golden results of the corpus are kept in tools/cli/golden.json and checked by CTest
+ */
+
+namespace
+{
+
+constexpr int GOLDEN_VERSION = 1;
+
+struct CorpusDictionary
+{
+    const char *name;
+    quint32 seed;
+    qint64 words;
+    int alphabetSize;
+    int fanOut;
+    int chains;
+    int chainDepth;
+};
+
+// the corpus must never change, otherwise the golden results must be recorded again.
+// The searches of the last two dictionaries take tens of milliseconds, they are
+// well above --min-time and keep the timing baseline meaningful
+const CorpusDictionary corpus[] = {
+    { "small",       1,   2000, 26, 3,  5,  6 },
+    { "dense",       2,  20000, 10, 6, 10, 10 },
+    { "medium",      3, 100000, 26, 3, 10, 12 },
+    { "large",       4, 500000, 26, 4, 20, 16 },
+    { "dense-large", 5,  50000, 10, 6,  5, 12 },
+    { "dense-huge",  6, 200000, 12, 6,  5, 12 }
+};
+
+// real words are searched too, they usually hit short chains of the random dictionaries
+const char *const commonSeeds[] = { "owl", "tea", "ail" };
+
+struct CaseResult
+{
+    QString dictionary;
+    QString seed;
+    int length;
+    int count;
+    QString chains;
+    double medianMs;
+};
+
+inline
+QString caseName(const QString &dictionary, const QString &seed)
+{
+    return dictionary + '/' + seed;
+}
+
+/*
+ *  Hash of the sorted chains, so the golden file stays small and the order
+ *  of the chains doesn't matter
+ */
+QString hashChains(const LongestPaths &paths)
+{
+    QStringList chains;
+
+    for(const LongestPath &path : paths)
+    {
+        QStringList words;
+
+        for(const std::string &str : path)
+            words.append(QString::fromStdString(str));
+
+        chains.append(words.join(' '));
+    }
+
+    chains.sort();
+
+    return QCryptographicHash::hash(chains.join('\n').toUtf8(), QCryptographicHash::Sha1).toHex();
+}
+
+QList<CaseResult> runCorpus(const QStringList &filter, int repetitions)
+{
+    QList<CaseResult> results;
+
+    for(const CorpusDictionary &dictionary : corpus)
+    {
+        if(!filter.isEmpty() && !filter.contains(dictionary.name))
+            continue;
+
+        DictionaryGenerator::Parameters parameters;
+
+        parameters.seed = dictionary.seed;
+        parameters.words = dictionary.words;
+        parameters.alphabetSize = dictionary.alphabetSize;
+        parameters.fanOut = dictionary.fanOut;
+        parameters.chains = dictionary.chains;
+        parameters.chainDepth = dictionary.chainDepth;
+
+        DictionaryGenerator generator(parameters);
+        QBuffer buffer;
+        buffer.setData(generator.generate());
+        buffer.open(QIODevice::ReadOnly);
+
+        DictionaryParser parser;
+        parser.parse(&buffer);
+
+        const DictionaryIndex index = DictionaryIndex::build(parser.anagrams(), parser.fingerprint());
+        AnagramSearch search(index);
+
+        QStringList seeds = generator.seeds();
+
+        for(const char *seed : commonSeeds)
+            seeds.append(seed);
+
+        for(const QString &seed : seeds)
+        {
+            LongestPaths paths;
+            std::vector<qint64> samples;
+            QElapsedTimer timer;
+
+            for(int i = 0;i < repetitions;i++)
+            {
+                timer.start();
+                paths = search.find(seed);
+                samples.push_back(timer.nsecsElapsed());
+            }
+
+            std::sort(samples.begin(), samples.end());
+
+            CaseResult result;
+
+            result.dictionary = dictionary.name;
+            result.seed = seed;
+            result.length = paths.isEmpty() ? 0 : paths.first().size();
+            result.count = paths.size();
+            result.chains = hashChains(paths);
+            result.medianMs = samples[samples.size() / 2] / 1e6;
+
+            results.append(result);
+        }
+    }
+
+    return results;
+}
+
+QJsonObject toJson(const CaseResult &result)
+{
+    QJsonObject object;
+
+    object["dictionary"] = result.dictionary;
+    object["seed"] = result.seed;
+    object["length"] = result.length;
+    object["count"] = result.count;
+    object["chains_sha1"] = result.chains;
+    object["median_ms"] = result.medianMs;
+
+    return object;
+}
+
+CaseResult fromJson(const QJsonObject &object)
+{
+    CaseResult result;
+
+    result.dictionary = object["dictionary"].toString();
+    result.seed = object["seed"].toString();
+    result.length = object["length"].toInt();
+    result.count = object["count"].toInt();
+    result.chains = object["chains_sha1"].toString();
+    result.medianMs = object["median_ms"].toDouble();
+
+    return result;
+}
+
+int record(const QString &path, const QList<CaseResult> &results, int repetitions)
+{
+    QJsonArray cases;
+
+    for(const CaseResult &result : results)
+        cases.append(toJson(result));
+
+    QJsonObject root;
+
+    root["version"] = GOLDEN_VERSION;
+    root["repetitions"] = repetitions;
+    root["cases"] = cases;
+
+    QSaveFile file(path);
+
+    if(!file.open(QFile::WriteOnly)
+            || file.write(QJsonDocument(root).toJson()) < 0
+            || !file.commit())
+    {
+        qCritical("Cannot save the golden results: %s", qPrintable(file.errorString()));
+        return 1;
+    }
+
+    QTextStream(stdout) << "Recorded " << results.size() << " case(s) into " << path << '\n';
+
+    return 0;
+}
+
+/*
+ *  Compare the results with the golden results. A golden case of the corpus dictionaries
+ *  in 'filter' (all if empty) that was not run is a failure too
+ */
+int check(const QString &path, const QList<CaseResult> &results, const QStringList &filter, double threshold, double minTime, bool checkTiming)
+{
+    QFile file(path);
+
+    if(!file.open(QFile::ReadOnly))
+    {
+        qCritical("Cannot open the golden results: %s", qPrintable(file.errorString()));
+        return 1;
+    }
+
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+
+    if(root["version"].toInt() != GOLDEN_VERSION)
+    {
+        qCritical("Unsupported golden results, record them again");
+        return 1;
+    }
+
+    QHash<QString, CaseResult> golden;
+
+    for(const QJsonValue &value : root["cases"].toArray())
+    {
+        const CaseResult result = fromJson(value.toObject());
+        golden.insert(caseName(result.dictionary, result.seed), result);
+    }
+
+    QTextStream out(stdout);
+    int passed = 0;
+    int failures = 0;
+    QSet<QString> checked;
+
+    for(const CaseResult &result : results)
+    {
+        const QString name = caseName(result.dictionary, result.seed);
+        auto it = golden.constFind(name);
+
+        checked.insert(name);
+
+        if(it == golden.constEnd())
+        {
+            out << "NEW       " << name << '\n';
+            continue;
+        }
+
+        QStringList problems;
+
+        if(result.length != it->length)
+            problems.append(QString("length %1, expected %2").arg(result.length).arg(it->length));
+
+        if(result.count != it->count)
+            problems.append(QString("%1 chain(s), expected %2").arg(result.count).arg(it->count));
+        else if(result.chains != it->chains)
+            problems.append("different chains");
+
+        const double slowdown = it->medianMs > 0 ? result.medianMs / it->medianMs - 1 : 0;
+
+        // short searches are too noisy to compare
+        if(checkTiming && it->medianMs >= minTime && slowdown > threshold)
+            problems.append(QString("%1ms, baseline %2ms (+%3%)")
+                            .arg(result.medianMs, 0, 'f', 3)
+                            .arg(it->medianMs, 0, 'f', 3)
+                            .arg(slowdown * 100, 0, 'f', 1));
+
+        if(problems.isEmpty())
+        {
+            passed++;
+            out << "OK        " << name << QString(" %1ms").arg(result.medianMs, 0, 'f', 3) << '\n';
+            continue;
+        }
+
+        failures++;
+        out << "FAIL      " << name << ": " << problems.join(", ") << '\n';
+    }
+
+    // a case that disappeared from the run would otherwise go unnoticed
+    for(auto it = golden.constBegin();it != golden.constEnd();++it)
+    {
+        if(checked.contains(it.key()) || (!filter.isEmpty() && !filter.contains(it->dictionary)))
+            continue;
+
+        failures++;
+        out << "MISSING   " << it.key() << '\n';
+    }
+
+    out << '\n' << passed << " passed, " << failures << " failed\n";
+
+    return failures ? 1 : 0;
+}
+
+}
+
+int commandRegress(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Check the search results and times against the golden results");
+    parser.addHelpOption();
+
+    const QCommandLineOption recordOption("record", "Run the corpus and save the golden results.", "path");
+    const QCommandLineOption checkOption("check", "Run the corpus and compare with the golden results.", "path");
+    const QCommandLineOption corpusOption("corpus", "Comma-separated names of the corpus dictionaries to run.", "names");
+    const QCommandLineOption repetitionsOption("repetitions", "Number of runs of every search, the median time is used.", "count", "5");
+    const QCommandLineOption thresholdOption("threshold", "Maximum allowed slowdown, 0.2 means 20%.", "ratio", "0.2");
+    const QCommandLineOption minTimeOption("min-time", "Don't compare the times of the searches faster than that.", "ms", "1");
+    const QCommandLineOption noTimingOption("no-timing", "Compare the results only.");
+
+    parser.addOptions({ recordOption, checkOption, corpusOption, repetitionsOption, thresholdOption, minTimeOption, noTimingOption });
+    parser.process(arguments);
+
+    if(parser.isSet(recordOption) == parser.isSet(checkOption))
+    {
+        qCritical("Either --record or --check must be specified");
+        parser.showHelp(1);
+    }
+
+    const int repetitions = std::max(1, parser.value(repetitionsOption).toInt());
+    const QStringList filter = parser.value(corpusOption).split(',', Qt::SkipEmptyParts);
+    const QList<CaseResult> results = runCorpus(filter, repetitions);
+
+    if(parser.isSet(recordOption))
+        return record(parser.value(recordOption), results, repetitions);
+
+    return check(parser.value(checkOption),
+                 results,
+                 filter,
+                 parser.value(thresholdOption).toDouble(),
+                 parser.value(minTimeOption).toDouble(),
+                 !parser.isSet(noTimingOption));
+}
@@ -0,0 +1,239 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "anagramsearch.h"
+#include "clicommon.h"
+#include "querylog.h"
+#include "commands.h"
+
+/*
+ *  Replay of a query log against the current build. The queries are executed by a number
+ *  of concurrent workers, and the throughput and the latency percentiles are reported:
+ *
+ *  anagrams_cli replay --log queries.jsonl --concurrency 8 --repeat 10
+ */
+
+namespace
+{
+
+struct Job
+{
+    int dictionary;
+    QString word;
+    SearchConstraints constraints;
+};
+
+/*
+ *  Worker executing the jobs until there are no more jobs. Every worker has its own
+ *  search object per dictionary, like the workers of SearchPool
+ */
+class ReplayWorker : public QRunnable
+{
+public:
+    ReplayWorker(const QVector<DictionaryIndex> &indexes,
+                 const QVector<Job> &jobs,
+                 QAtomicInt *nextJob,
+                 std::vector<qint64> *latencies)
+        : m_indexes(indexes)
+        , m_jobs(jobs)
+        , m_nextJob(nextJob)
+        , m_latencies(latencies)
+    {}
+
+    virtual void run() override
+    {
+        std::vector<std::unique_ptr<AnagramSearch>> searches(m_indexes.size());
+        QElapsedTimer timer;
+
+        for(int i = m_nextJob->fetchAndAddRelaxed(1);i < m_jobs.size();i = m_nextJob->fetchAndAddRelaxed(1))
+        {
+            const Job &job = m_jobs[i];
+            std::unique_ptr<AnagramSearch> &search = searches[job.dictionary];
+
+            if(!search)
+                search.reset(new AnagramSearch(m_indexes[job.dictionary]));
+
+            timer.start();
+            search->setConstraints(job.constraints);
+            search->find(job.word);
+
+            // every job is written by a single worker
+            (*m_latencies)[i] = timer.nsecsElapsed();
+        }
+    }
+
+private:
+    const QVector<DictionaryIndex> &m_indexes;
+    const QVector<Job> &m_jobs;
+    QAtomicInt *m_nextJob;
+    std::vector<qint64> *m_latencies;
+};
+
+double percentile(const std::vector<qint64> &sorted, double p)
+{
+    const std::size_t i = static_cast<std::size_t>(std::ceil(sorted.size() * p));
+    return sorted[std::min(sorted.size() - 1, i > 0 ? i - 1 : 0)] / 1e6;
+}
+
+}
+
+int commandReplay(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Replay a query log and report the throughput and the latencies");
+    parser.addHelpOption();
+
+    const QCommandLineOption logOption("log", "Query log to replay.", "path");
+    const QCommandLineOption dictionaryOption("dictionary", "Replay all the queries against this dictionary.", "path");
+    const QCommandLineOption concurrencyOption("concurrency", "Number of concurrent workers.", "count", "1");
+    const QCommandLineOption repeatOption("repeat", "Replay the log a number of times.", "count", "1");
+    const QCommandLineOption skipCachedOption("skip-cached", "Skip the queries served from the result store.");
+    const QCommandLineOption jsonOption("json", "Print the report as JSON.");
+
+    parser.addOptions({ logOption, dictionaryOption, concurrencyOption, repeatOption, skipCachedOption, jsonOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(logOption))
+        parser.showHelp(1);
+
+    QString errorString;
+    const QList<QueryLogEntry> entries = QueryLog::load(parser.value(logOption), &errorString);
+
+    if(!errorString.isEmpty())
+    {
+        qCritical("Cannot read the query log: %s", qPrintable(errorString));
+        return 1;
+    }
+
+    // load every dictionary once
+    QHash<QString, int> dictionaryNumbers;
+    QVector<DictionaryIndex> indexes;
+    QVector<Job> loggedJobs;
+    double loggedTime = 0;
+
+    for(const QueryLogEntry &entry : entries)
+    {
+        if(entry.cached && parser.isSet(skipCachedOption))
+            continue;
+
+        const QString dictionary = parser.isSet(dictionaryOption) ? parser.value(dictionaryOption) : entry.dictionary;
+        auto it = dictionaryNumbers.constFind(dictionary);
+
+        if(it == dictionaryNumbers.constEnd())
+        {
+            const DictionaryIndex index = loadIndex(dictionary);
+
+            if(index.isNull())
+                return 1;
+
+            // the results and the timings are not comparable with the log then
+            if(!parser.isSet(dictionaryOption) && !entry.fingerprint.isEmpty() && index.fingerprint() != entry.fingerprint)
+                qWarning("The dictionary %s has been changed since the queries were logged", qPrintable(dictionary));
+
+            it = dictionaryNumbers.insert(dictionary, indexes.size());
+            indexes.append(index);
+        }
+
+        loggedJobs.append({ it.value(), entry.word, SearchConstraints::fromJson(entry.options.value("constraints").toObject()) });
+        loggedTime += entry.timeMs;
+    }
+
+    if(loggedJobs.isEmpty())
+    {
+        qCritical("There are no queries to replay");
+        return 1;
+    }
+
+    QVector<Job> jobs;
+    const int repeat = std::max(1, parser.value(repeatOption).toInt());
+
+    for(int i = 0;i < repeat;i++)
+        jobs += loggedJobs;
+
+    const int concurrency = std::max(1, parser.value(concurrencyOption).toInt());
+    std::vector<qint64> latencies(jobs.size());
+    QAtomicInt nextJob(0);
+    QThreadPool pool;
+
+    pool.setMaxThreadCount(concurrency);
+
+    QElapsedTimer wallTimer;
+    wallTimer.start();
+
+    for(int i = 0;i < concurrency;i++)
+        pool.start(new ReplayWorker(indexes, jobs, &nextJob, &latencies));
+
+    pool.waitForDone();
+
+    const double wallTime = wallTimer.nsecsElapsed() / 1e9;
+
+    std::sort(latencies.begin(), latencies.end());
+
+    double totalLatency = 0;
+
+    for(qint64 latency : latencies)
+        totalLatency += latency / 1e6;
+
+    const double throughput = wallTime > 0 ? jobs.size() / wallTime : 0;
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonObject root;
+
+        root["log"] = parser.value(logOption);
+        root["queries"] = jobs.size();
+        root["dictionaries"] = indexes.size();
+        root["concurrency"] = concurrency;
+        root["wall_s"] = wallTime;
+        root["throughput_per_s"] = throughput;
+        root["mean_ms"] = totalLatency / jobs.size();
+        root["p50_ms"] = percentile(latencies, 0.50);
+        root["p90_ms"] = percentile(latencies, 0.90);
+        root["p99_ms"] = percentile(latencies, 0.99);
+        root["max_ms"] = latencies.back() / 1e6;
+        root["logged_mean_ms"] = loggedTime / loggedJobs.size();
+
+        QTextStream(stdout) << QJsonDocument(root).toJson();
+        return 0;
+    }
+
+    QTextStream(stdout) << "Queries:      " << jobs.size() << " (" << indexes.size() << " dictionaries)\n"
+                        << "Concurrency:  " << concurrency << '\n'
+                        << "Wall time:    " << QString::number(wallTime, 'f', 3) << "s\n"
+                        << "Throughput:   " << QString::number(throughput, 'f', 1) << " queries/s\n"
+                        << "Latency, ms:  mean " << QString::number(totalLatency / jobs.size(), 'f', 3)
+                        << ", p50 " << QString::number(percentile(latencies, 0.50), 'f', 3)
+                        << ", p90 " << QString::number(percentile(latencies, 0.90), 'f', 3)
+                        << ", p99 " << QString::number(percentile(latencies, 0.99), 'f', 3)
+                        << ", max " << QString::number(latencies.back() / 1e6, 'f', 3) << '\n'
+                        << "Logged mean:  " << QString::number(loggedTime / loggedJobs.size(), 'f', 3) << "ms\n";
+
+    return 0;
+}
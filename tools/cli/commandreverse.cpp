@@ -0,0 +1,136 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "reversesearch.h"
+#include "clicommon.h"
+#include "commands.h"
+#include "tracer.h"
+
+int commandReverse(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Find the shortest words the target words are derived from");
+    parser.addHelpOption();
+    parser.addPositionalArgument("targets", "Target words.", "targets...");
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to search in.", "path");
+    const QCommandLineOption jsonOption("json", "Print the chains and the search counters as JSON.");
+    const QCommandLineOption statisticsOption("statistics", "Print the search counters.");
+    const QCommandLineOption traceOption("trace", "Save the timeline of the phases in the Chrome trace format.", "path");
+
+    parser.addOptions({ dictionaryOption, jsonOption, statisticsOption, traceOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(dictionaryOption) || parser.positionalArguments().isEmpty())
+        parser.showHelp(1);
+
+    if(parser.isSet(traceOption))
+        Tracer::instance()->start(parser.value(traceOption));
+
+    const DictionaryIndex index = loadIndex(parser.value(dictionaryOption));
+
+    if(index.isNull())
+        return 1;
+
+    QTextStream out(stdout);
+    QJsonArray queries;
+    ReverseSearch search(index);
+
+    for(const QString &target : parser.positionalArguments())
+    {
+        SearchStatistics statistics;
+        QElapsedTimer timer;
+        timer.start();
+
+        const LongestPaths chains = search.find(target, &statistics);
+        const qint64 elapsed = timer.nsecsElapsed();
+
+        if(parser.isSet(jsonOption))
+        {
+            QJsonObject query;
+            QJsonArray jsonChains;
+
+            for(const LongestPath &chain : chains)
+            {
+                QJsonArray jsonChain;
+
+                for(const std::string &str : chain)
+                    jsonChain.append(QString::fromStdString(str));
+
+                jsonChains.append(jsonChain);
+            }
+
+            query["target"] = target;
+            query["time_ms"] = elapsed / 1e6;
+            query["chains"] = jsonChains;
+            query["statistics"] = statistics.toJson();
+
+            queries.append(query);
+            continue;
+        }
+
+        out << target << ": " << chains.size() << " word(s)";
+
+        if(!chains.isEmpty())
+            out << " of " << chains.first().first().length() << " letter(s)";
+
+        out << " in " << QString::number(elapsed / 1e6, 'f', 3) << "ms\n";
+
+        for(const LongestPath &chain : chains)
+        {
+            QStringList words;
+
+            for(const std::string &str : chain)
+                words.append(QString::fromStdString(str));
+
+            out << "    " << words.join(" -> ") << '\n';
+        }
+
+        if(parser.isSet(statisticsOption))
+        {
+            for(int i = 0;i < statistics.depths.size();i++)
+            {
+                const DepthStatistics &depth = statistics.depths[i];
+
+                out << "    depth " << i
+                    << ": keys " << depth.nodes
+                    << ", probes " << depth.probes
+                    << ", hits " << depth.hits
+                    << ", found before " << depth.skipped << '\n';
+            }
+        }
+    }
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonObject root;
+        root["dictionary"] = parser.value(dictionaryOption);
+        root["queries"] = queries;
+
+        out << QJsonDocument(root).toJson();
+    }
+
+    return Tracer::instance()->save() ? 0 : 1;
+}
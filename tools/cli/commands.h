@@ -0,0 +1,45 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef COMMANDS_H
+#define COMMANDS_H
+
+#include <QtCore>
+
+/*
+ *  Commands of anagrams_cli. Every command parses its own options, the first
+ *  argument is the name of the executable. Returns the exit code
+ */
+int commandSearch(const QStringList &arguments);
+int commandMemory(const QStringList &arguments);
+int commandRegress(const QStringList &arguments);
+int commandFuzz(const QStringList &arguments);
+int commandReplay(const QStringList &arguments);
+int commandReverse(const QStringList &arguments);
+int commandLadder(const QStringList &arguments);
+int commandRack(const QStringList &arguments);
+int commandLookup(const QStringList &arguments);
+
+#endif // COMMANDS_H
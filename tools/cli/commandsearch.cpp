@@ -0,0 +1,186 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "anagramsearch.h"
+#include "clicommon.h"
+#include "querylog.h"
+#include "commands.h"
+#include "tracer.h"
+
+int commandSearch(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Find the longest chains of anagram derivations");
+    parser.addHelpOption();
+    parser.addPositionalArgument("words", "Starting words.", "words...");
+
+    const QCommandLineOption dictionaryOption("dictionary", "Dictionary to search in.", "path");
+    const QCommandLineOption jsonOption("json", "Print the chains and the search counters as JSON.");
+    const QCommandLineOption statisticsOption("statistics", "Print the search counters.");
+    const QCommandLineOption traceOption("trace", "Save the timeline of the phases in the Chrome trace format.", "path");
+    const QCommandLineOption queryLogOption("query-log", "Append the queries to the query log.", "path");
+    const QCommandLineOption profileOption("profile", "Profile the search: time per depth and the hottest keys.");
+    const QCommandLineOption topOption("top", "Number of the hottest keys in the profile.", "count", "20");
+    const QCommandLineOption excludeOption("exclude", "Never add these letters to the words.", "letters");
+    const QCommandLineOption requireOption("require", "The last word of the chains must contain these letters.", "letters");
+    const QCommandLineOption maxLengthOption("max-length", "Maximum length of the words.", "length", "0");
+    const QCommandLineOption stepOption("step", "Maximum number of letters added per step.", "letters", "1");
+
+    parser.addOptions({ dictionaryOption, jsonOption, statisticsOption, traceOption, queryLogOption, profileOption, topOption,
+                        excludeOption, requireOption, maxLengthOption, stepOption });
+    parser.process(arguments);
+
+    if(!parser.isSet(dictionaryOption) || parser.positionalArguments().isEmpty())
+        parser.showHelp(1);
+
+    if(parser.isSet(traceOption))
+        Tracer::instance()->start(parser.value(traceOption));
+
+    const DictionaryIndex index = loadIndex(parser.value(dictionaryOption));
+
+    if(index.isNull())
+        return 1;
+
+    QTextStream out(stdout);
+    QJsonArray queries;
+    SearchConstraints constraints;
+    constraints.excludedLetters = parser.value(excludeOption);
+    constraints.requiredLetters = parser.value(requireOption);
+    constraints.maxLength = parser.value(maxLengthOption).toInt();
+    constraints.maxStep = parser.value(stepOption).toInt();
+
+    AnagramSearch search(index);
+    search.setConstraints(constraints);
+
+    for(const QString &word : parser.positionalArguments())
+    {
+        SearchStatistics statistics;
+        SearchProfile profile(parser.value(topOption).toInt());
+        QElapsedTimer timer;
+        timer.start();
+
+        const LongestPaths paths = search.find(word, &statistics, parser.isSet(profileOption) ? &profile : nullptr);
+        const qint64 elapsed = timer.nsecsElapsed();
+
+        if(parser.isSet(queryLogOption))
+        {
+            QueryLogEntry entry;
+
+            entry.timestamp = QDateTime::currentDateTime();
+            entry.source = "cli";
+            entry.dictionary = parser.value(dictionaryOption);
+            entry.fingerprint = index.fingerprint();
+            entry.word = word;
+            entry.timeMs = elapsed / 1e6;
+            entry.chains = paths.size();
+            entry.length = paths.isEmpty() ? 0 : paths.first().size();
+
+            if(!constraints.isEmpty())
+                entry.options["constraints"] = constraints.toJson();
+
+            QueryLog(parser.value(queryLogOption)).append(entry);
+        }
+
+        if(parser.isSet(jsonOption))
+        {
+            QJsonObject query;
+
+            query["word"] = word;
+            query["time_ms"] = elapsed / 1e6;
+            query["chains"] = chainsToJson(word, paths);
+
+            if(!constraints.isEmpty())
+                query["constraints"] = constraints.toJson();
+
+            query["statistics"] = statistics.toJson();
+
+            if(!profile.isEmpty())
+                query["profile"] = profile.toJson();
+
+            queries.append(query);
+            continue;
+        }
+
+        out << word << ": " << paths.size() << " chain(s) in " << QString::number(elapsed / 1e6, 'f', 3) << "ms";
+
+        if(!constraints.isEmpty())
+            out << " (" << constraints.toString() << ')';
+
+        out << '\n';
+
+        for(const LongestPath &path : paths)
+        {
+            out << "    " << word;
+
+            for(const std::string &str : path)
+                out << " -> " << QString::fromStdString(str);
+
+            out << '\n';
+        }
+
+        if(parser.isSet(statisticsOption))
+        {
+            const DepthStatistics total = statistics.total();
+
+            out << "    nodes expanded: " << total.nodes
+                << ", hash probes: " << total.probes
+                << ", hits: " << total.hits
+                << ", subtrees skipped: " << total.skipped
+                << ", max depth: " << statistics.maxDepth()
+                << ", new longest: " << statistics.newLongest
+                << ", peak chains: " << statistics.peakChains << '\n';
+
+            for(int i = 0;i < statistics.depths.size();i++)
+            {
+                const DepthStatistics &depth = statistics.depths[i];
+
+                out << "    depth " << i
+                    << ": nodes " << depth.nodes
+                    << ", probes " << depth.probes
+                    << ", hits " << depth.hits
+                    << ", skipped " << depth.skipped << '\n';
+            }
+
+            out << "    memory:\n";
+
+            for(const QString &line : statistics.memory.toString().split('\n', Qt::SkipEmptyParts))
+                out << "        " << line << '\n';
+        }
+
+        if(!profile.isEmpty())
+            out << '\n' << profile.toString() << '\n';
+    }
+
+    if(parser.isSet(jsonOption))
+    {
+        QJsonObject root;
+        root["dictionary"] = parser.value(dictionaryOption);
+        root["queries"] = queries;
+
+        out << QJsonDocument(root).toJson();
+    }
+
+    return Tracer::instance()->save() ? 0 : 1;
+}
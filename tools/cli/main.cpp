@@ -0,0 +1,105 @@
+/*  This file is part of ANAGRAMS (https://github.com/HappySeaFox/anagrams)
+
+    Copyright (c) 2025 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <QtCore>
+
+#include "commands.h"
+
+/*
+ *  Headless front-end of the anagram derivation finder. The first argument is a command:
+ *
+ *  anagrams_cli search --dictionary words.txt owl ail --json
+ *  anagrams_cli memory --dictionary words.txt
+ *  anagrams_cli regress --check golden.json
+ *  anagrams_cli fuzz --iterations 100000
+ *  anagrams_cli replay --log queries.jsonl --concurrency 8
+ *  anagrams_cli reverse --dictionary words.txt orchestra
+ *  anagrams_cli ladder --dictionary words.txt owl bowler
+ *  anagrams_cli rack --dictionary words.txt retains?
+ *  anagrams_cli lookup --dictionary words.txt --input words.txt > groups.txt
+ */
+
+namespace
+{
+
+struct Command
+{
+    const char *name;
+    const char *description;
+    int (*run)(const QStringList &arguments);
+};
+
+const Command commands[] = {
+    { "search", "Find the longest chains of anagram derivations", commandSearch },
+    { "memory", "Report the memory used by the dictionary", commandMemory },
+    { "regress", "Check the results and times against the golden results", commandRegress },
+    { "fuzz", "Compare the optimized searches with the reference search", commandFuzz },
+    { "replay", "Replay a query log and report the throughput and the latencies", commandReplay },
+    { "reverse", "Find the shortest words the target words are derived from", commandReverse },
+    { "ladder", "Find the shortest chains from one word to another", commandLadder },
+    { "rack", "Find the words made of the letters of the racks", commandRack },
+    { "lookup", "Print the anagram groups of the words read line by line", commandLookup }
+};
+
+void printUsage()
+{
+    QTextStream out(stderr);
+
+    out << "Usage: anagrams_cli <command> [options]\n\nCommands:\n";
+
+    for(const Command &command : commands)
+        out << "  " << QString(command.name).leftJustified(12) << command.description << '\n';
+
+    out << "\nRun 'anagrams_cli <command> --help' for the options of the command\n";
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QStringList arguments = app.arguments();
+
+    if(arguments.size() < 2)
+    {
+        printUsage();
+        return 1;
+    }
+
+    // the parser of the command sees "anagrams_cli <options>"
+    const QString name = arguments.takeAt(1);
+
+    for(const Command &command : commands)
+    {
+        if(name == command.name)
+            return command.run(arguments);
+    }
+
+    qCritical("Unknown command: %s", qPrintable(name));
+    printUsage();
+
+    return 1;
+}